@@ -19,11 +19,24 @@ void sensor_init(void);
  */
 void sensor_working(void);
 
+/**
+ * @brief Function for measurement averaging
+ * @details Takes the CO2 and TVOC averages of the samples since the previous call and starts
+ * the next period. Called by every output, and instead of it while the display sleeps.
+ */
+void sensor_average(void);
+
 /**
  * @brief Function for output values from sensors
  */
 void sensor_out(void);
 
+/**
+ * @brief Function for screen repaint request
+ * @details The shown screen is cleared and drawn again in full by its next update
+ */
+void screen_refresh(void);
+
 /**
  * @brief Menu function
  * @details This function is used to select parameters for setting the limits of the norm
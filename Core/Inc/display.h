@@ -0,0 +1,226 @@
+#ifndef __DISPLAY_H__
+#define __DISPLAY_H__
+
+#include "ST7735.h"
+#include "ST7735_WIDGET.h"
+
+/* Number of draw commands the render queue can hold */
+#ifndef DISPLAY_QUEUE_LEN
+#define DISPLAY_QUEUE_LEN 32
+#endif
+
+/* Maximum text length of a queued text command, including the terminating zero */
+#define DISPLAY_TEXT_LEN ST7735_WIDGET_MAX_LEN
+
+/* Size of the recorded operations of a display list in bytes */
+#ifndef DISPLAY_LIST_SIZE
+#define DISPLAY_LIST_SIZE 192
+#endif
+
+/* Number of alert levels, the banner of a higher alert hides the lower ones */
+#ifndef DISPLAY_ALERT_LEVELS
+#define DISPLAY_ALERT_LEVELS 4
+#endif
+
+/* Area of the alert banner, over the bottom of the screen */
+#define DISPLAY_ALERT_X 0
+#define DISPLAY_ALERT_Y 146
+#define DISPLAY_ALERT_W ST7735_TFTWIDTH_128
+#define DISPLAY_ALERT_H 14
+
+/* Bound used for areas reaching the edge of the screen in any rotation */
+#define DISPLAY_EDGE ST7735_TFTHEIGHT_160
+
+/**
+ * @brief Retained display list of a static screen
+ * @details The screen layout is recorded as a compact sequence of operations. Ending a recording
+ * compares it with the sequence on the screen and queues only what changed.
+ * @param ops Operations being recorded
+ * @param len Length of ops
+ * @param shown Operations on the screen
+ * @param shown_len Length of shown
+ */
+typedef struct {
+	uint8_t ops[DISPLAY_LIST_SIZE];
+	uint16_t len;
+	uint8_t shown[DISPLAY_LIST_SIZE];
+	uint16_t shown_len;
+} display_list_t;
+
+/**
+ * @brief Function for render task creation
+ * @details The render task owns the display once the scheduler runs: the display_* functions
+ * only queue commands for it. Must be called before the scheduler is started.
+ */
+void display_start(void);
+
+/**
+ * @brief Function for pending commands rendering
+ * @details Draws the queued commands in order and flushes the display. Run by the render task
+ * each time it is woken, the host simulator calls it in place of the task.
+ */
+void display_render(void);
+
+/**
+ * @brief Function for text output
+ * @details Before the scheduler is started the text is drawn immediately
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] text Text to print, truncated to DISPLAY_TEXT_LEN - 1 characters
+ * @param[in] color Text color
+ * @param[in] bg Background color
+ * @param[in] size Text magnification
+ */
+void display_text(int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg,
+		uint8_t size);
+
+/**
+ * @brief Function for text widget update
+ * @details Only the last pending update of a widget is drawn
+ * @param[in] widget Widget to update
+ * @param[in] text New text of the widget
+ */
+void display_widget(st7735_widget_t *widget, const char *text);
+
+/**
+ * @brief Function for text widget invalidation
+ * @details The next update of the widget repaints all of its characters
+ * @param[in] widget Widget to invalidate
+ */
+void display_widget_invalidate(st7735_widget_t *widget);
+
+/**
+ * @brief Function for chart sample output
+ * @details Every sample is drawn, chart commands are never merged or dropped
+ * @param[in] chart Chart to update
+ * @param[in] value New sample
+ */
+void display_chart(st7735_chart_t *chart, int32_t value);
+
+/**
+ * @brief Function for chart invalidation
+ * @details The next sample of the chart repaints the whole plot
+ * @param[in] chart Chart to invalidate
+ */
+void display_chart_invalidate(st7735_chart_t *chart);
+
+/**
+ * @brief Function for rectangle filling
+ * @details Pending commands completely hidden by the rectangle are dropped
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] w Width
+ * @param[in] h Height
+ * @param[in] color Fill color
+ */
+void display_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/**
+ * @brief Function for screen filling
+ * @param[in] color Fill color
+ */
+void display_fill(uint16_t color);
+
+/**
+ * @brief Function for rectangle outline drawing
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] w Width
+ * @param[in] h Height
+ * @param[in] color Outline color
+ */
+void display_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+/**
+ * @brief Function for image drawing
+ * @details The pixels are read when the command is rendered, they must stay valid until then
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] w Width
+ * @param[in] h Height
+ * @param[in] pixels RGB565 pixels, w * h values
+ */
+void display_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
+/**
+ * @brief Function for run-length encoded image drawing
+ * @details The image is decoded from its data when the command is rendered
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] image Image, must stay valid until the command is rendered
+ * @param[in] color Ink color of a 1-bit image
+ * @param[in] bg Background color of a 1-bit image, equal to color for a transparent background
+ */
+void display_image(int16_t x, int16_t y, const st7735_image_t *image, uint16_t color,
+		uint16_t bg);
+
+/**
+ * @brief Function for alert raising
+ * @details The banner of the highest raised alert is shown over the screen content, which is
+ * drawn on underneath. Raising an alert again replaces its text and colors.
+ * @param[in] level Alert level, below DISPLAY_ALERT_LEVELS
+ * @param[in] text Banner text, truncated to ST7735_OVERLAY_TEXT_LEN - 1 characters
+ * @param[in] color Text color
+ * @param[in] bg Background color
+ * @note The banner needs the framebuffer, without it alerts are not shown
+ */
+void display_alert(uint8_t level, const char *text, uint16_t color, uint16_t bg);
+
+/**
+ * @brief Function for alert clearing
+ * @details Only the area of the banner is repainted, from the content under it
+ * @param[in] level Alert level, below DISPLAY_ALERT_LEVELS
+ */
+void display_alert_clear(uint8_t level);
+
+/**
+ * @brief Function for display sleep control
+ * @details The display keeps its picture while it sleeps and shows it again on waking up. The
+ * pending commands are drawn in order around the transition.
+ * @param[in] on True to put the display to sleep, false to wake it up
+ */
+void display_sleep(bool on);
+
+/**
+ * @brief Function for display list recording start
+ * @param[in] list Display list to record
+ */
+void display_list_begin(display_list_t *list);
+
+/**
+ * @brief Function for display list text recording
+ * @details The text ends at the first '\r' or '\n'. Operations not fitting in the list are lost.
+ * @param[in] list Display list being recorded
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] text Text to print, truncated to DISPLAY_TEXT_LEN - 1 characters
+ * @param[in] color Text color
+ * @param[in] bg Background color, must differ from the text color
+ * @param[in] size Text magnification
+ */
+void display_list_text(display_list_t *list, int16_t x, int16_t y, const char *text,
+		uint16_t color, uint16_t bg, uint8_t size);
+
+/**
+ * @brief Function for display list rectangle recording
+ * @param[in] list Display list being recorded
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ * @param[in] w Width
+ * @param[in] h Height
+ * @param[in] color Fill color
+ */
+void display_list_fill_rect(display_list_t *list, int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color);
+
+/**
+ * @brief Function for display list recording end
+ * @details When the list is already on the screen, only the characters of texts which changed are
+ * queued, nothing at all if the recording is identical. When another list or any other command
+ * was drawn since, or the layout changed, the whole list is replayed.
+ * @param[in] list Display list being recorded
+ * @return True if anything was queued
+ */
+bool display_list_end(display_list_t *list);
+
+#endif /* __DISPLAY_H__ */
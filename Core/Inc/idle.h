@@ -0,0 +1,26 @@
+#ifndef __IDLE_H__
+#define __IDLE_H__
+
+#include <stdbool.h>
+
+/* Time without button presses after which the display goes to sleep, 0 keeps it on */
+#ifndef IDLE_TIMEOUT_MS
+#define IDLE_TIMEOUT_MS (5 * 60 * 1000)
+#endif
+
+/**
+ * @brief Function for user activity registration
+ * @details Called for every button press, also from interrupt handlers
+ * @return True if the display sleeps, the press only has to wake it
+ */
+bool idle_activity(void);
+
+/**
+ * @brief Function for display sleep management
+ * @details Puts the display to sleep once IDLE_TIMEOUT_MS passed since the last activity and wakes
+ * it after a new one. Called by the output task before every screen update.
+ * @return True if the display sleeps and nothing has to be drawn
+ */
+bool idle_update(void);
+
+#endif /* __IDLE_H__ */
@@ -2,6 +2,7 @@
 #define __INIT_H__
 
 #include "ST7735.h"
+#include "ST7735_WIDGET.h"
 #include "BMP280.h"
 #include "AHT10.h"
 #include "CCS811.h"
@@ -10,6 +11,12 @@
 /* This structure defines the object for interacting with the BMP280 sensor using the `BMP280_HandleTypedef` type. */
 extern struct BMP280_HandleTypedef bmp280;
 
+/* This structure defines the object for interacting with the AHT10 sensor using the `AHT10_HandleTypedef` type. */
+extern struct AHT10_HandleTypedef aht10;
+
+/* This structure defines the object for interacting with the CCS811 sensor using the `CCS811_HandleTypedef` type. */
+extern struct CCS811_HandleTypedef ccs811;
+
 /**
  * @brief Enumeration of possible initialization results.
  * @details This enumeration describes different initialization states for various components.
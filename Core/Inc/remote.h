@@ -0,0 +1,28 @@
+#ifndef __REMOTE_H__
+#define __REMOTE_H__
+
+#include <stdint.h>
+
+/* Command byte received on USART1 which starts screen mirroring */
+#define REMOTE_CMD_MIRROR_ON 'M'
+
+/* Command byte received on USART1 which stops screen mirroring */
+#define REMOTE_CMD_MIRROR_OFF 'm'
+
+/**
+ * @brief Function for remote task creation
+ * @details The remote task listens for commands on USART1 and streams the mirrored screen, see
+ * ST7735_MIRROR.h for the format. Must be called before the scheduler is started.
+ */
+void remote_start(void);
+
+/**
+ * @brief Function for USART1 output
+ * @details Every writer of USART1 goes through this function, so text lines and mirroring
+ * packets are never interleaved
+ * @param[in] data Bytes to send
+ * @param[in] size Number of bytes
+ */
+void remote_send(const uint8_t *data, uint16_t size);
+
+#endif /* __REMOTE_H__ */
@@ -14,39 +14,32 @@ typedef enum {
 	READ_TEMPERATURE_ERR = -40, /* Error reading temperature data. */
 } read_state_t;
 
-/* This external array is used to store the results from different sensor readings. */
-extern uint16_t res[2];
-
-/**
- * @brief Retrieves the humidity reading.
- * @details This function retrieves the current humidity reading from the humidity sensor.
- * @return The humidity reading as a floating-point value.
- */
-float get_humidity_readings(void);
-
-/**
- * @brief Retrieves the pressure reading.
- * @details This function retrieves the current pressure reading from the BMP280 sensor.
- * @param[in] device Pointer to the BMP280 deviceice handle for communication with the sensor.
- * @return The pressure reading as a floating-point value.
- */
-float get_pressure_readings(struct BMP280_HandleTypedef *device);
-
 /**
- * @brief Retrieves the temperature reading.
- * @details This function retrieves the current temperature reading from the BMP280 sensor.
- * @param[in] device Pointer to the BMP280 deviceice handle for communication with the sensor.
- * @return The temperature reading as a floating-point value.
+ * @brief Readings of all I2C sensors taken in one acquisition cycle.
+ * @details A value which could not be read holds the matching read_state_t error code.
  */
-float get_temperature_readings(struct BMP280_HandleTypedef *device);
+typedef struct {
+	float temperature; /* Average of the AHT10 and BMP280 temperatures. */
+	float humidity;    /* AHT10 humidity. */
+	float pressure;    /* BMP280 pressure. */
+	uint16_t co2;      /* CCS811 eCO2, valid when co2_ready is set. */
+	uint16_t tvoc;     /* CCS811 TVOC, valid when co2_ready is set. */
+	bool co2_ready;    /* The CCS811 had new data. */
+} sensor_readings_t;
 
 /**
- * @brief Retrieves the CO2 reading.
- * @details This function retrieves the current CO2 reading from the CO2 sensor.
- * @param[in] _hi2c Pointer to the I2C object used for communication with the sensor.
- * @return Pointer to the CO2 reading value stored in a uint16_t array.
+ * @brief Retrieves the readings of all I2C sensors at once.
+ * @details The three sensors sit on their own buses, so their transfers are started together and
+ * the cycle takes as long as the slowest sensor. The AHT10 values come from the measurement
+ * started by the previous call, which converted in between, so nothing waits for the conversion.
+ * @param[in] aht10_device Pointer to the AHT10 device handle for communication with the sensor.
+ * @param[in] device Pointer to the BMP280 device handle for communication with the sensor.
+ * @param[in] ccs811_device Pointer to the CCS811 device handle for communication with the sensor.
+ * @param[out] readings The readings.
  */
-uint16_t *get_co2_readings(I2C_HandleTypeDef *_hi2c);
+void get_sensor_readings(struct AHT10_HandleTypedef *aht10_device,
+		struct BMP280_HandleTypedef *device, struct CCS811_HandleTypedef *ccs811_device,
+		sensor_readings_t *readings);
 
 /**
  * @brief Retrieves the brightness reading.
@@ -1,7 +1,9 @@
 #include <stdio.h>
 #include "common.h"
+#include "display.h"
+#include "remote.h"
+#include "ST7735_ICONS.h"
 #include "cmsis_os.h"
-#include <string.h>
 
 #define TEMP_ERR -40
 
@@ -17,7 +19,6 @@ extern I2C_HandleTypeDef hi2c2;
 extern I2C_HandleTypeDef hi2c3;
 extern TIM_HandleTypeDef htim3;
 extern TIM_HandleTypeDef htim4;
-extern UART_HandleTypeDef huart1;
 extern UART_HandleTypeDef huart2;
 
 /* Variables for storing measurements*/
@@ -28,6 +29,8 @@ static uint32_t brightness = 0;
 static uint16_t pressure_get = 0;
 static uint16_t co2_avg_sum = 0;
 static uint16_t tvoc_avg_sum = 0;
+static uint16_t co2_avg = 0;
+static uint16_t tvoc_avg = 0;
 
 /* UART variables */
 static uint16_t uart_tx_size;
@@ -39,6 +42,56 @@ static uint8_t hum_min = 30, hum_max = 60, tmp_min = 22, tmp_max = 26;
 static uint8_t barrier = 1;
 static uint8_t avg_cnt = 0;
 
+/* Text widgets of the measurements screen, one per line */
+enum { W_HUM, W_PRESS, W_TEMP, W_CO2, W_TVOC, W_LIGHT, W_COUNT };
+static st7735_widget_t sensor_widgets[W_COUNT];
+
+/* Trend charts under the text, one per measured channel */
+enum { C_HUM, C_PRESS, C_TEMP, C_CO2, C_LIGHT, C_COUNT };
+static st7735_chart_t sensor_charts[C_COUNT];
+
+/* Plot range of every chart */
+static const int32_t chart_range[C_COUNT][2] = {
+		[C_HUM] = {0, 100},
+		[C_PRESS] = {720, 780},
+		[C_TEMP] = {0, 50},
+		[C_CO2] = {400, 2000},
+		[C_LIGHT] = {0, 1000},
+};
+
+/* Trace color of every chart */
+static const uint16_t chart_color[C_COUNT] = {ST77XX_CYAN, ST77XX_MAGENTA, ST77XX_ORANGE,
+		ST77XX_GREEN, ST77XX_YELLOW};
+
+/* Left edge and character cells of the measurement lines */
+#define WIDGET_X 2
+#define WIDGET_CELLS ((ST7735_TFTWIDTH_128 - WIDGET_X) / 6)
+
+/* Status icons right of the temperature and CO2 lines, which stop short of them */
+#define ICON_X 116
+#define ICON_CELLS ((ICON_X - WIDGET_X) / 6)
+#define ICON_COMFORT_Y 24
+#define ICON_CO2_Y 36
+
+/* Comfort and CO2 levels, also the index of their icon color */
+enum { LEVEL_GOOD, LEVEL_FAIR, LEVEL_BAD, LEVEL_NONE };
+static const uint16_t level_color[] = {ST77XX_GREEN, ST77XX_YELLOW, ST77XX_RED};
+
+/* Levels shown by the status icons, LEVEL_NONE after the screen was cleared */
+static uint8_t comfort_shown = LEVEL_NONE, co2_shown = LEVEL_NONE;
+
+/* Alert banners, the CO2 one hides the comfort one */
+enum { ALERT_COMFORT, ALERT_CO2, ALERT_COUNT };
+
+/* Alerts raised on the display */
+static bool alert_raised[ALERT_COUNT];
+
+/* Display lists of the static screens */
+static display_list_t menu_list, limits_list;
+
+/* True while the measurements screen is shown and its widgets match the display */
+static bool sensor_screen = false;
+
 typedef void (*ButtonHandler)(void);
 
 /* Button hendlers */
@@ -101,12 +154,67 @@ static void Set_RGB_Color(uint16_t red, uint16_t green, uint16_t blue) {
 static void log_out(const char *format, unsigned int args, uint8_t x, uint8_t y) {
 	if (args) {
 		uart_tx_size = sprintf((char *)uart_tx_data, format, args);
-		ST7735_print_config(x, y, (char *)uart_tx_data, ST77XX_WHITE, ST77XX_BLACK, 1, 1);
+		display_text(x, y, (char *)uart_tx_data, ST77XX_WHITE, ST77XX_BLACK, 1);
 	} else {
 		uart_tx_size = sprintf((char *)uart_tx_data, format);
-		ST7735_print_config(x, y, (char *)uart_tx_data, ST77XX_WHITE, ST77XX_BLACK, 1, 1);
+		display_text(x, y, (char *)uart_tx_data, ST77XX_WHITE, ST77XX_BLACK, 1);
 	}
-	HAL_UART_Transmit(&huart1, uart_tx_data, uart_tx_size, 1000);
+	remote_send(uart_tx_data, uart_tx_size);
+}
+
+/**
+ * @brief Function for static screen start
+ * @details Starts recording the screen into its display list, over a cleared background
+ * @param[in] list Display list of the screen
+ */
+static void screen_begin(display_list_t *list) {
+	sensor_screen = false;
+	uart_tx_size = 0;
+	display_list_begin(list);
+	display_list_fill_rect(list, 0, 0, DISPLAY_EDGE, DISPLAY_EDGE, ST7735_BLACK);
+}
+
+/**
+ * @brief Function for static screen line output
+ * @details The line is recorded into the display list and collected for the UART log
+ * @param[in] list Display list of the screen
+ * @param[in] format А pointer to a constant format string
+ * @param[in] args Argument for output
+ * @param[in] x Position X
+ * @param[in] y Position Y
+ */
+static void screen_out(display_list_t *list, const char *format, unsigned int args, uint8_t x,
+		uint8_t y) {
+	char *line = (char *)&uart_tx_data[uart_tx_size];
+	int len = snprintf(line, sizeof(uart_tx_data) - uart_tx_size, format, args);
+	display_list_text(list, x, y, line, ST77XX_WHITE, ST77XX_BLACK, 1);
+	if (len > 0)
+		uart_tx_size += len;
+	if (uart_tx_size > sizeof(uart_tx_data) - 1)
+		uart_tx_size = sizeof(uart_tx_data) - 1;
+}
+
+/**
+ * @brief Function for static screen end
+ * @details Draws only what changed since the screen was last shown, the UART log is only sent
+ * along with a change
+ * @param[in] list Display list of the screen
+ */
+static void screen_end(display_list_t *list) {
+	if (display_list_end(list))
+		remote_send(uart_tx_data, uart_tx_size);
+}
+
+/**
+ * @brief Function for measurement output
+ * @param[in] widget Widget showing the measurement
+ * @param[in] format А pointer to a constant format string
+ * @param[in] args Argument for output
+ */
+static void value_out(st7735_widget_t *widget, const char *format, unsigned int args) {
+	uart_tx_size = sprintf((char *)uart_tx_data, format, args);
+	display_widget(widget, (char *)uart_tx_data);
+	remote_send(uart_tx_data, uart_tx_size);
 }
 
 void sensor_init(void) {
@@ -131,68 +239,168 @@ void sensor_init(void) {
 			log_out("CCS811: Start\r\n", 0, 2, 50);
 		}
 		log_out("INITIALIZATION \r\nFINISHED\r\n", 0, 0, 62);
+		ST7735_flush();
 		HAL_Delay(2000);
 	}
+	for (uint8_t i = 0; i < W_COUNT; i++) {
+		uint8_t cells = (i == W_TEMP || i == W_CO2) ? ICON_CELLS : WIDGET_CELLS;
+		ST7735_widget_init(&sensor_widgets[i], WIDGET_X, 2 + i * 12, ST77XX_WHITE, ST77XX_BLACK,
+				1, 1, cells);
+	}
+	for (uint8_t i = 0; i < C_COUNT; i++) {
+		ST7735_chart_init(&sensor_charts[i], 0, 75 + i * 17, ST7735_TFTWIDTH_128, 16,
+				chart_range[i][0], chart_range[i][1], chart_color[i], ST77XX_BLACK);
+	}
 }
 
 void sensor_working(void) {
-	uint16_t co2_tvoc_read[2] = {0};
-	hum_get = (get_humidity_readings() / 100);
-	pressure_get = (get_pressure_readings(&bmp280) / 100);
-	tmp_get = (get_temperature_readings(&bmp280));
-	memcpy(co2_tvoc_read, get_co2_readings(&hi2c3), sizeof(co2_tvoc_read));
-	if (avg_cnt < 10) {
-		co2_avg_sum += co2_tvoc_read[0];
-		tvoc_avg_sum += co2_tvoc_read[1];
+	sensor_readings_t readings;
+	get_sensor_readings(&aht10, &bmp280, &ccs811, &readings);
+	hum_get = (readings.humidity / 100);
+	pressure_get = (readings.pressure / 100);
+	tmp_get = readings.temperature;
+	/* Only new CCS811 data goes into the average */
+	if (readings.co2_ready && (avg_cnt < 10)) {
+		co2_avg_sum += readings.co2;
+		tvoc_avg_sum += readings.tvoc;
 		avg_cnt++;
 	}
 	brightness = calculate_brightness(&hadc1);
 }
 
+/**
+ * @brief Function for comfort level calculation
+ * @return LEVEL_GOOD if temperature and humidity are within the limits, LEVEL_FAIR if one of
+ * them is slightly out of them, LEVEL_BAD otherwise
+ */
+static uint8_t comfort_level(void) {
+	if (IS_GREEN_RANGE(tmp_get, tmp_min, tmp_max) && IS_GREEN_RANGE(hum_get, hum_min, hum_max))
+		return LEVEL_GOOD;
+	if (IS_YELLOW_RANGE(hum_get, hum_min, hum_max) || IS_YELLOW_RANGE(tmp_get, tmp_min, tmp_max))
+		return LEVEL_FAIR;
+	return LEVEL_BAD;
+}
+
+/**
+ * @brief Function for alert banner output
+ * @details The alert is only queued when its state changed
+ * @param[in] alert Alert to raise or clear
+ * @param[in] raise True to raise the alert, false to clear it
+ * @param[in] text Banner text
+ * @param[in] bg Banner color
+ */
+static void alert_out(uint8_t alert, bool raise, const char *text, uint16_t bg) {
+	if (raise == alert_raised[alert])
+		return;
+	if (raise)
+		display_alert(alert, text, ST77XX_WHITE, bg);
+	else
+		display_alert_clear(alert);
+	alert_raised[alert] = raise;
+}
+
+/**
+ * @brief Function for status icons output
+ * @details An icon is only queued when its level changed since it was drawn, bad levels raise
+ * an alert
+ * @param[in] co2 Averaged CO2 concentration in ppm
+ */
+static void status_icons_out(uint16_t co2) {
+	uint8_t comfort = comfort_level();
+	uint8_t air = co2 < 800 ? LEVEL_GOOD : (co2 < 1500 ? LEVEL_FAIR : LEVEL_BAD);
+
+	if (comfort != comfort_shown) {
+		display_image(ICON_X, ICON_COMFORT_Y,
+				comfort == LEVEL_GOOD ? &icon_comfort_good : &icon_comfort_bad,
+				level_color[comfort], ST77XX_BLACK);
+		comfort_shown = comfort;
+	}
+	if (air != co2_shown) {
+		display_image(ICON_X, ICON_CO2_Y, &icon_co2, level_color[air], ST77XX_BLACK);
+		co2_shown = air;
+	}
+	/* Bad levels also get a banner over the charts, it stays until the level recovers */
+	alert_out(ALERT_COMFORT, comfort == LEVEL_BAD, "Climate out of limits", ST77XX_ORANGE);
+	alert_out(ALERT_CO2, air == LEVEL_BAD, "High CO2, ventilate", ST77XX_RED);
+}
+
+void sensor_average(void) {
+	/* A press waking the display cuts the period short, an empty one keeps the last averages */
+	if (avg_cnt) {
+		co2_avg = co2_avg_sum / avg_cnt;
+		tvoc_avg = tvoc_avg_sum / avg_cnt;
+	}
+	co2_avg_sum = 0;
+	tvoc_avg_sum = 0;
+	avg_cnt = 0;
+}
+
 void sensor_out(void) {
 	osDelay(10);
-	ST7735_fill(ST7735_BLACK);
+	sensor_average();
+	/* Another screen was shown, start from a clean one */
+	if (!sensor_screen) {
+		display_fill(ST7735_BLACK);
+		for (uint8_t i = 0; i < W_COUNT; i++) {
+			display_widget_invalidate(&sensor_widgets[i]);
+		}
+		for (uint8_t i = 0; i < C_COUNT; i++) {
+			display_chart_invalidate(&sensor_charts[i]);
+		}
+		comfort_shown = LEVEL_NONE;
+		co2_shown = LEVEL_NONE;
+		sensor_screen = true;
+	}
 	if (hum_get < 0) {
-		log_out("Humidity reading failed\r\n", 0, 2, 2);
+		value_out(&sensor_widgets[W_HUM], "Humidity: error\r\n", 0);
 	} else {
-		log_out("Humidity: %u %% \r\n", hum_get, 2, 2);
+		value_out(&sensor_widgets[W_HUM], "Humidity: %u %% \r\n", hum_get);
 	}
 	if (pressure_get < 0) {
-		log_out("Pressure reading failed\r\n", 0, 2, 14);
+		value_out(&sensor_widgets[W_PRESS], "Pressure: error\r\n", 0);
 	} else {
-		log_out("Pressure: %u mmHg \r\n", (unsigned int)pressure_get, 2, 14);
+		value_out(&sensor_widgets[W_PRESS], "Pressure: %u mmHg \r\n", (unsigned int)pressure_get);
 	}
 	if (tmp_get <= TEMP_ERR) {
-		log_out("Temperature reading failed\r\n", 0, 2, 26);
+		value_out(&sensor_widgets[W_TEMP], "Temperature: error\r\n", 0);
 	} else {
-		log_out("Temperature: %u C \r\n", tmp_get, 2, 26);
+		value_out(&sensor_widgets[W_TEMP], "Temperature: %u C \r\n", tmp_get);
 	}
-	log_out("CO2: %u ppm \r\n", co2_avg_sum / 10, 2, 38);
-	log_out("TVOC: %u \r\n", tvoc_avg_sum / 10, 2, 50);
-	log_out("Brightness: %lu LUX \r\n", brightness, 2, 62);
-	co2_avg_sum = 0;
-	tvoc_avg_sum = 0;
-	avg_cnt = 0;
+	value_out(&sensor_widgets[W_CO2], "CO2: %u ppm \r\n", co2_avg);
+	value_out(&sensor_widgets[W_TVOC], "TVOC: %u \r\n", tvoc_avg);
+	value_out(&sensor_widgets[W_LIGHT], "Brightness: %lu LUX \r\n", brightness);
+	display_chart(&sensor_charts[C_HUM], hum_get);
+	display_chart(&sensor_charts[C_PRESS], pressure_get);
+	display_chart(&sensor_charts[C_TEMP], tmp_get);
+	display_chart(&sensor_charts[C_CO2], co2_avg);
+	display_chart(&sensor_charts[C_LIGHT], brightness);
+	status_icons_out(co2_avg);
+}
+
+void screen_refresh(void) {
+	sensor_screen = false;
+	display_fill(ST7735_BLACK);
 }
 
 void menu_func(void) {
-	ST7735_fill(ST7735_BLACK);
-	log_out("Menu:\r\n", 0, 2, 2);
-	log_out("	* Temperature limits\r\n", 0, 2, 14);
-	log_out("	* Humidity limits\r\n", 0, 2, 26);
+	screen_begin(&menu_list);
+	screen_out(&menu_list, "Menu:\r\n", 0, 2, 2);
+	screen_out(&menu_list, "	* Temperature limits\r\n", 0, 2, 14);
+	screen_out(&menu_list, "	* Humidity limits\r\n", 0, 2, 26);
 	if (barrier > 2 || barrier < 1) {
 		barrier = 1;
 	}
-	log_out("	* Choose: %u \r\n", barrier, 2, 38);
+	screen_out(&menu_list, "	* Choose: %u \r\n", barrier, 2, 38);
+	screen_end(&menu_list);
 	osDelay(1000);
 }
 
 void led_func(void) {
-	if (IS_GREEN_RANGE(tmp_get, tmp_min, tmp_max) && IS_GREEN_RANGE(hum_get, hum_min, hum_max)) {
+	uint8_t comfort = comfort_level();
+	if (comfort == LEVEL_GOOD) {
 		Set_RGB_Color(255, 1, 255);   //Green
 
-	} else if (IS_YELLOW_RANGE(hum_get, hum_min, hum_max) ||
-			   IS_YELLOW_RANGE(tmp_get, tmp_min, tmp_max)) {
+	} else if (comfort == LEVEL_FAIR) {
 		Set_RGB_Color(100, 10, 255);   //Yellow
 	} else {
 		Set_RGB_Color(1, 255, 255);   //Red
@@ -205,9 +413,10 @@ void led_func(void) {
 
 void barrier_ctrl_func(void) {
 	if (hum) {
-		ST7735_fill(ST7735_BLACK);
-		log_out("Humidity min: %u \r\n", hum_min, 2, 2);
-		log_out("Humidity max: %u \r\n", hum_max, 2, 14);
+		screen_begin(&limits_list);
+		screen_out(&limits_list, "Humidity min: %u \r\n", hum_min, 2, 2);
+		screen_out(&limits_list, "Humidity max: %u \r\n", hum_max, 2, 14);
+		screen_end(&limits_list);
 		if (!ok) {
 			hum_min = barrier;
 		} else {
@@ -217,9 +426,10 @@ void barrier_ctrl_func(void) {
 			}
 		}
 	} else if (tmp) {
-		ST7735_fill(ST7735_BLACK);
-		log_out("Temperature min: %u \r\n", tmp_min, 2, 2);
-		log_out("Temperature max: %u \r\n", tmp_max, 2, 14);
+		screen_begin(&limits_list);
+		screen_out(&limits_list, "Temperature min: %u \r\n", tmp_min, 2, 2);
+		screen_out(&limits_list, "Temperature max: %u \r\n", tmp_max, 2, 14);
+		screen_end(&limits_list);
 		if (!ok) {
 			tmp_min = barrier;
 		} else {
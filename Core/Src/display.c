@@ -0,0 +1,609 @@
+#include "display.h"
+#include "cmsis_os.h"
+#include <string.h>
+#include <stdbool.h>
+
+/* The alert banner is composited by the framebuffer flush, there is no other way to show it */
+#if !ST7735_USE_FRAMEBUFFER
+#warning "ST7735_USE_FRAMEBUFFER is disabled, display_alert() banners will not be shown"
+#endif
+
+/* Thread flag used to wake the render task */
+#define DISPLAY_FLAG_WORK 0x01
+
+/* Draw command types */
+typedef enum {
+	DISPLAY_CMD_NONE = 0, /* Dropped by coalescing, skipped by the render task */
+	DISPLAY_CMD_TEXT,
+	DISPLAY_CMD_WIDGET,
+	DISPLAY_CMD_INVALIDATE,
+	DISPLAY_CMD_FILL_RECT,
+	DISPLAY_CMD_RECT,
+	DISPLAY_CMD_BLIT,
+	DISPLAY_CMD_IMAGE,
+	DISPLAY_CMD_CHART,
+	DISPLAY_CMD_CHART_INVALIDATE,
+	DISPLAY_CMD_SLEEP,
+	DISPLAY_CMD_ALERT,
+	DISPLAY_CMD_ALERT_CLEAR,
+} display_cmd_type_t;
+
+/* Queued draw command */
+typedef struct {
+	display_cmd_type_t type;
+	int16_t x, y, w, h;
+	uint16_t color, bg;
+	uint8_t size;
+	st7735_widget_t *widget;
+	st7735_chart_t *chart;
+	int32_t value;
+	const uint16_t *pixels;
+	const st7735_image_t *image;
+	char text[DISPLAY_TEXT_LEN];
+} display_cmd_t;
+
+/* Screen area, corners inclusive */
+typedef struct {
+	int16_t x0, y0, x1, y1;
+} display_area_t;
+
+/* Display list operation codes */
+enum { DISPLAY_OP_FILL_RECT = 1, DISPLAY_OP_TEXT };
+
+/* Size of the fixed part of the encoded operations in bytes */
+#define DISPLAY_OP_FILL_RECT_SIZE 11
+#define DISPLAY_OP_TEXT_SIZE 11
+
+/* Decoded display list operation */
+typedef struct {
+	uint8_t op;
+	int16_t x, y, w, h;
+	uint16_t color, bg;
+	uint8_t size, len;
+	const uint8_t *text;
+} display_op_t;
+
+/* Display list on the screen, NULL after any other command was drawn */
+static const display_list_t *list_shown;
+
+/* Banners of the raised alerts, only used by the render task */
+static st7735_overlay_t alerts[DISPLAY_ALERT_LEVELS];
+static bool alert_raised[DISPLAY_ALERT_LEVELS];
+
+/* Level of the alert shown in the overlay, -1 when none is */
+static int8_t alert_shown = -1;
+
+/* Render queue, a ring of commands protected by the scheduler lock */
+static display_cmd_t queue[DISPLAY_QUEUE_LEN];
+static uint8_t queue_head, queue_count;
+
+/* Definitions for displayTask */
+static osThreadId_t displayTaskHandle;
+static const osThreadAttr_t displayTask_attributes = {
+	.name = "displayTask",
+	.stack_size = 256 * 4,
+	.priority = (osPriority_t)osPriorityBelowNormal,
+};
+
+/**
+ * @brief Function for alert banner update
+ * @details Shows the banner of the highest raised alert in the overlay. The overlay is only
+ * changed when that alert is another one or is the one just changed.
+ * @param[in] level Level of the alert just raised or cleared
+ */
+static void display_alert_update(uint8_t level) {
+	int8_t top = DISPLAY_ALERT_LEVELS - 1;
+	while ((top >= 0) && !alert_raised[top])
+		top--;
+	if ((top != alert_shown) || (top == level))
+		ST7735_overlay(top < 0 ? NULL : &alerts[top]);
+	alert_shown = top;
+}
+
+/**
+ * @brief Function for command rendering
+ * @param[in] cmd Command to draw
+ */
+static void display_execute(display_cmd_t *cmd) {
+	switch (cmd->type) {
+		case DISPLAY_CMD_TEXT:
+			ST7735_print_config(cmd->x, cmd->y, cmd->text, cmd->color, cmd->bg, cmd->size,
+					cmd->size);
+			break;
+		case DISPLAY_CMD_WIDGET:
+			ST7735_widget_set_text(cmd->widget, cmd->text);
+			break;
+		case DISPLAY_CMD_INVALIDATE:
+			ST7735_widget_invalidate(cmd->widget);
+			break;
+		case DISPLAY_CMD_FILL_RECT:
+			ST7735_fill_rect(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color);
+			break;
+		case DISPLAY_CMD_RECT:
+			ST7735_rect(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color);
+			break;
+		case DISPLAY_CMD_BLIT:
+			ST7735_blit(cmd->x, cmd->y, cmd->w, cmd->h, cmd->pixels);
+			break;
+		case DISPLAY_CMD_IMAGE:
+			ST7735_image(cmd->x, cmd->y, cmd->image, cmd->color, cmd->bg);
+			break;
+		case DISPLAY_CMD_CHART:
+			ST7735_chart_add(cmd->chart, cmd->value);
+			break;
+		case DISPLAY_CMD_CHART_INVALIDATE:
+			ST7735_chart_invalidate(cmd->chart);
+			break;
+		case DISPLAY_CMD_SLEEP:
+			ST7735_sleep(cmd->value);
+			break;
+		case DISPLAY_CMD_ALERT:
+			alerts[cmd->size] = (st7735_overlay_t){.x = DISPLAY_ALERT_X, .y = DISPLAY_ALERT_Y,
+					.w = DISPLAY_ALERT_W, .h = DISPLAY_ALERT_H, .color = cmd->color,
+					.bg = cmd->bg};
+			strncpy(alerts[cmd->size].text, cmd->text, ST7735_OVERLAY_TEXT_LEN - 1);
+			alert_raised[cmd->size] = true;
+			display_alert_update(cmd->size);
+			break;
+		case DISPLAY_CMD_ALERT_CLEAR:
+			alert_raised[cmd->size] = false;
+			display_alert_update(cmd->size);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Function for text measuring
+ * @param[in] cmd Text command
+ * @return Number of characters on the first line, or -1 if the text takes several lines
+ */
+static int16_t display_text_cells(const display_cmd_t *cmd) {
+	int16_t n = strcspn(cmd->text, "\r\n");
+	if (cmd->text[n] == '\n' || (cmd->text[n] == '\r' && strchr(&cmd->text[n], '\n')))
+		return -1;
+	/* Text running past the right edge wraps to the next line */
+	if (cmd->x + n * 6 * cmd->size > ST7735_TFTWIDTH_128)
+		return -1;
+	return n;
+}
+
+/**
+ * @brief Function for command extent calculation
+ * @details The extent contains every pixel the command may touch
+ * @param[in] cmd Command
+ * @param[out] a Extent of the command
+ * @return False if the command draws nothing
+ */
+static bool display_extent(const display_cmd_t *cmd, display_area_t *a) {
+	int16_t n;
+	switch (cmd->type) {
+		case DISPLAY_CMD_TEXT:
+			n = display_text_cells(cmd);
+			if (n < 0) {
+				/* Wrapped or multi-line text, assume everything below its first line */
+				*a = (display_area_t){0, cmd->y, DISPLAY_EDGE - 1, INT16_MAX};
+			} else {
+				*a = (display_area_t){cmd->x, cmd->y, cmd->x + n * 6 * cmd->size - 1,
+						cmd->y + 8 * cmd->size - 1};
+			}
+			return true;
+		case DISPLAY_CMD_WIDGET:
+		case DISPLAY_CMD_INVALIDATE:
+			*a = (display_area_t){cmd->widget->x, cmd->widget->y,
+					cmd->widget->x + cmd->widget->cells * 6 * cmd->widget->size_x - 1,
+					cmd->widget->y + 8 * cmd->widget->size_y - 1};
+			return true;
+		case DISPLAY_CMD_CHART:
+		case DISPLAY_CMD_CHART_INVALIDATE:
+			*a = (display_area_t){cmd->chart->x, cmd->chart->y, cmd->chart->x + cmd->chart->w - 1,
+					cmd->chart->y + cmd->chart->h - 1};
+			return true;
+		case DISPLAY_CMD_FILL_RECT:
+		case DISPLAY_CMD_RECT:
+		case DISPLAY_CMD_BLIT:
+			*a = (display_area_t){cmd->x, cmd->y, cmd->x + cmd->w - 1, cmd->y + cmd->h - 1};
+			return true;
+		case DISPLAY_CMD_IMAGE:
+			*a = (display_area_t){cmd->x, cmd->y, cmd->x + cmd->image->w - 1,
+					cmd->y + cmd->image->h - 1};
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief Function for opaque area calculation
+ * @details Every pixel of the area is overwritten by the command, whatever was drawn before
+ * @param[in] cmd Command
+ * @param[out] a Opaque area of the command
+ * @return False if the command has no opaque area
+ */
+static bool display_cover(const display_cmd_t *cmd, display_area_t *a) {
+	switch (cmd->type) {
+		case DISPLAY_CMD_TEXT:
+			/* Only single-line text with its own background hides what is under it */
+			if (cmd->bg == cmd->color || display_text_cells(cmd) < 0)
+				return false;
+			return display_extent(cmd, a);
+		case DISPLAY_CMD_FILL_RECT:
+		case DISPLAY_CMD_BLIT:
+			return display_extent(cmd, a);
+		case DISPLAY_CMD_IMAGE:
+			/* A 1-bit image drawn without background leaves the pixels under it */
+			if ((cmd->image->format == ST7735_IMAGE_RLE1) && (cmd->bg == cmd->color))
+				return false;
+			return display_extent(cmd, a);
+		default:
+			return false;
+	}
+}
+
+/**
+ * @brief Function for area intersection test
+ */
+static bool display_overlap(const display_area_t *a, const display_area_t *b) {
+	return (a->x0 <= b->x1) && (b->x0 <= a->x1) && (a->y0 <= b->y1) && (b->y0 <= a->y1);
+}
+
+/**
+ * @brief Function for area inclusion test
+ * @return True if area a lies inside area b
+ */
+static bool display_inside(const display_area_t *a, const display_area_t *b) {
+	return (a->x0 >= b->x0) && (a->x1 <= b->x1) && (a->y0 >= b->y0) && (a->y1 <= b->y1);
+}
+
+/**
+ * @brief Function for widget update merging
+ * @details Walks back from the newest command. The pending update of the same widget takes the
+ * new text if no command drawing over the widget was queued after it.
+ * @param[in] cmd New widget update
+ * @return True if the update was merged into a pending one
+ */
+static bool display_merge_widget(const display_cmd_t *cmd) {
+	display_area_t area, other;
+	display_extent(cmd, &area);
+	for (uint8_t i = queue_count; i > 0; i--) {
+		display_cmd_t *pending = &queue[(queue_head + i - 1) % DISPLAY_QUEUE_LEN];
+		if (pending->type == DISPLAY_CMD_NONE)
+			continue;
+		if ((pending->type == DISPLAY_CMD_WIDGET) && (pending->widget == cmd->widget)) {
+			memcpy(pending->text, cmd->text, DISPLAY_TEXT_LEN);
+			return true;
+		}
+		if (display_extent(pending, &other) && display_overlap(&area, &other))
+			return false;
+	}
+	return false;
+}
+
+/**
+ * @brief Function for hidden command removal
+ * @details Drops pending commands which would be completely overdrawn by the new one. Widget
+ * and chart commands are kept, their state has to follow every update.
+ * @param[in] cmd New command
+ */
+static void display_drop_hidden(const display_cmd_t *cmd) {
+	display_area_t cover, other;
+	if (!display_cover(cmd, &cover))
+		return;
+	for (uint8_t i = 0; i < queue_count; i++) {
+		display_cmd_t *pending = &queue[(queue_head + i) % DISPLAY_QUEUE_LEN];
+		if ((pending->type == DISPLAY_CMD_WIDGET) || (pending->type == DISPLAY_CMD_INVALIDATE) ||
+				(pending->type == DISPLAY_CMD_CHART) ||
+				(pending->type == DISPLAY_CMD_CHART_INVALIDATE))
+			continue;
+		if (display_extent(pending, &other) && display_inside(&other, &cover))
+			pending->type = DISPLAY_CMD_NONE;
+	}
+}
+
+/**
+ * @brief Function for command submission
+ * @details Coalesces the command with the pending ones and wakes the render task. Before the
+ * scheduler is started the command is drawn immediately.
+ * @param[in] cmd Command to submit
+ */
+static void display_submit(const display_cmd_t *cmd) {
+	if (osKernelGetState() != osKernelRunning) {
+		display_cmd_t copy = *cmd;
+		display_execute(&copy);
+		return;
+	}
+
+	for (;;) {
+		osKernelLock();
+		if ((cmd->type == DISPLAY_CMD_WIDGET) && display_merge_widget(cmd)) {
+			osKernelUnlock();
+			break;
+		}
+		display_drop_hidden(cmd);
+		/* Reclaim dropped commands at the head of the ring */
+		while (queue_count && (queue[queue_head].type == DISPLAY_CMD_NONE)) {
+			queue_head = (queue_head + 1) % DISPLAY_QUEUE_LEN;
+			queue_count--;
+		}
+		if (queue_count < DISPLAY_QUEUE_LEN) {
+			queue[(queue_head + queue_count) % DISPLAY_QUEUE_LEN] = *cmd;
+			queue_count++;
+			osKernelUnlock();
+			break;
+		}
+		osKernelUnlock();
+		/* Queue is full, let the render task catch up */
+		osDelay(1);
+	}
+	osThreadFlagsSet(displayTaskHandle, DISPLAY_FLAG_WORK);
+}
+
+/**
+ * @brief Function for command submission from outside of display lists
+ * @param[in] cmd Command to submit
+ */
+static void display_submit_direct(const display_cmd_t *cmd) {
+	/* The screen does not match any display list any more */
+	list_shown = NULL;
+	display_submit(cmd);
+}
+
+/**
+ * @brief Function implementing the displayTask thread
+ * @param argument Not used
+ */
+static void display_task(void *argument) {
+	for (;;) {
+		osThreadFlagsWait(DISPLAY_FLAG_WORK, osFlagsWaitAny, osWaitForever);
+		display_render();
+	}
+}
+
+void display_render(void) {
+	display_cmd_t cmd;
+	for (;;) {
+		osKernelLock();
+		if (queue_count == 0) {
+			osKernelUnlock();
+			break;
+		}
+		cmd = queue[queue_head];
+		queue_head = (queue_head + 1) % DISPLAY_QUEUE_LEN;
+		queue_count--;
+		osKernelUnlock();
+		display_execute(&cmd);
+	}
+	/* Queue drained, push the changes out */
+	ST7735_flush();
+}
+
+void display_start(void) {
+	displayTaskHandle = osThreadNew(display_task, NULL, &displayTask_attributes);
+}
+
+void display_text(int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg,
+		uint8_t size) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_TEXT, .x = x, .y = y, .color = color, .bg = bg,
+			.size = size};
+	strncpy(cmd.text, text, DISPLAY_TEXT_LEN - 1);
+	display_submit_direct(&cmd);
+}
+
+void display_widget(st7735_widget_t *widget, const char *text) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_WIDGET, .widget = widget};
+	strncpy(cmd.text, text, DISPLAY_TEXT_LEN - 1);
+	display_submit_direct(&cmd);
+}
+
+void display_widget_invalidate(st7735_widget_t *widget) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_INVALIDATE, .widget = widget};
+	display_submit_direct(&cmd);
+}
+
+void display_chart(st7735_chart_t *chart, int32_t value) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_CHART, .chart = chart, .value = value};
+	display_submit_direct(&cmd);
+}
+
+void display_chart_invalidate(st7735_chart_t *chart) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_CHART_INVALIDATE, .chart = chart};
+	display_submit_direct(&cmd);
+}
+
+void display_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_FILL_RECT, .x = x, .y = y, .w = w, .h = h,
+			.color = color};
+	display_submit_direct(&cmd);
+}
+
+void display_fill(uint16_t color) {
+	display_fill_rect(0, 0, DISPLAY_EDGE, DISPLAY_EDGE, color);
+}
+
+void display_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_RECT, .x = x, .y = y, .w = w, .h = h,
+			.color = color};
+	display_submit_direct(&cmd);
+}
+
+void display_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_BLIT, .x = x, .y = y, .w = w, .h = h,
+			.pixels = pixels};
+	display_submit_direct(&cmd);
+}
+
+void display_image(int16_t x, int16_t y, const st7735_image_t *image, uint16_t color,
+		uint16_t bg) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_IMAGE, .x = x, .y = y, .image = image,
+			.color = color, .bg = bg};
+	display_submit_direct(&cmd);
+}
+
+void display_alert(uint8_t level, const char *text, uint16_t color, uint16_t bg) {
+	/* The banner lies above the screen content, display lists stay valid under it */
+	display_cmd_t cmd = {.type = DISPLAY_CMD_ALERT, .size = level, .color = color, .bg = bg};
+	if (level >= DISPLAY_ALERT_LEVELS)
+		return;
+	strncpy(cmd.text, text, DISPLAY_TEXT_LEN - 1);
+	display_submit(&cmd);
+}
+
+void display_alert_clear(uint8_t level) {
+	display_cmd_t cmd = {.type = DISPLAY_CMD_ALERT_CLEAR, .size = level};
+	if (level >= DISPLAY_ALERT_LEVELS)
+		return;
+	display_submit(&cmd);
+}
+
+void display_sleep(bool on) {
+	/* Draws nothing, so it is neither dropped nor stops the merging of widget updates */
+	display_cmd_t cmd = {.type = DISPLAY_CMD_SLEEP, .value = on};
+	display_submit(&cmd);
+}
+
+/**
+ * @brief Function for display list byte output
+ * @return False if the list is full
+ */
+static bool display_list_put(display_list_t *list, const uint8_t *data, uint16_t size) {
+	if (list->len + size > DISPLAY_LIST_SIZE)
+		return false;
+	memcpy(&list->ops[list->len], data, size);
+	list->len += size;
+	return true;
+}
+
+/**
+ * @brief Function for display list operation decoding
+ * @param[in] ops Encoded operations
+ * @param[in,out] pos Offset of the operation, moved to the next one
+ * @param[out] op Decoded operation
+ */
+static void display_list_decode(const uint8_t *ops, uint16_t *pos, display_op_t *op) {
+	const uint8_t *p = &ops[*pos];
+	memset(op, 0, sizeof(*op));
+	op->op = p[0];
+	op->x = p[1] | (p[2] << 8);
+	op->y = p[3] | (p[4] << 8);
+	if (op->op == DISPLAY_OP_FILL_RECT) {
+		op->w = p[5] | (p[6] << 8);
+		op->h = p[7] | (p[8] << 8);
+		op->color = p[9] | (p[10] << 8);
+		*pos += DISPLAY_OP_FILL_RECT_SIZE;
+	} else {
+		op->color = p[5] | (p[6] << 8);
+		op->bg = p[7] | (p[8] << 8);
+		op->size = p[9];
+		op->len = p[10];
+		op->text = &p[DISPLAY_OP_TEXT_SIZE];
+		*pos += DISPLAY_OP_TEXT_SIZE + op->len;
+	}
+}
+
+/**
+ * @brief Function for display list operation drawing
+ * @param[in] op Operation to queue
+ */
+static void display_list_draw(const display_op_t *op) {
+	display_cmd_t cmd = {.x = op->x, .y = op->y, .w = op->w, .h = op->h, .color = op->color,
+			.bg = op->bg, .size = op->size};
+	if (op->op == DISPLAY_OP_FILL_RECT) {
+		cmd.type = DISPLAY_CMD_FILL_RECT;
+	} else {
+		cmd.type = DISPLAY_CMD_TEXT;
+		memcpy(cmd.text, op->text, op->len);
+	}
+	display_submit(&cmd);
+}
+
+/**
+ * @brief Function for display list text update
+ * @details Queues the span of characters which differ, characters left over from a longer old
+ * text are cleared with spaces
+ * @param[in] old Operation on the screen
+ * @param[in] op New operation at the same place
+ */
+static void display_list_draw_text_diff(const display_op_t *old, const display_op_t *op) {
+	uint8_t len = old->len > op->len ? old->len : op->len;
+	int16_t first = -1, last = -1;
+	for (uint8_t i = 0; i < len; i++) {
+		char was = (i < old->len) ? old->text[i] : ' ';
+		char now = (i < op->len) ? op->text[i] : ' ';
+		if (was != now) {
+			if (first < 0)
+				first = i;
+			last = i;
+		}
+	}
+	if (first < 0)
+		return;
+
+	display_cmd_t cmd = {.type = DISPLAY_CMD_TEXT, .x = op->x + first * 6 * op->size, .y = op->y,
+			.color = op->color, .bg = op->bg, .size = op->size};
+	for (int16_t i = first; i <= last; i++)
+		cmd.text[i - first] = (i < op->len) ? op->text[i] : ' ';
+	display_submit(&cmd);
+}
+
+void display_list_begin(display_list_t *list) {
+	list->len = 0;
+}
+
+void display_list_text(display_list_t *list, int16_t x, int16_t y, const char *text,
+		uint16_t color, uint16_t bg, uint8_t size) {
+	uint8_t len = strcspn(text, "\r\n");
+	if (len > DISPLAY_TEXT_LEN - 1)
+		len = DISPLAY_TEXT_LEN - 1;
+	uint8_t op[DISPLAY_OP_TEXT_SIZE] = {DISPLAY_OP_TEXT, x, x >> 8, y, y >> 8, color, color >> 8,
+			bg, bg >> 8, size, len};
+	uint16_t start = list->len;
+	if (!display_list_put(list, op, sizeof(op)) ||
+			!display_list_put(list, (const uint8_t *)text, len))
+		list->len = start;
+}
+
+void display_list_fill_rect(display_list_t *list, int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color) {
+	uint8_t op[DISPLAY_OP_FILL_RECT_SIZE] = {DISPLAY_OP_FILL_RECT, x, x >> 8, y, y >> 8, w, w >> 8,
+			h, h >> 8, color, color >> 8};
+	display_list_put(list, op, sizeof(op));
+}
+
+bool display_list_end(display_list_t *list) {
+	display_op_t old, op;
+	uint16_t old_pos = 0, pos = 0;
+	bool replay = (list_shown != list);
+
+	if (!replay && (list->len == list->shown_len) && !memcmp(list->ops, list->shown, list->len))
+		return false;
+
+	/* Only texts may change in place, any other difference redraws the whole list */
+	while (!replay && (pos < list->len) && (old_pos < list->shown_len)) {
+		display_list_decode(list->shown, &old_pos, &old);
+		display_list_decode(list->ops, &pos, &op);
+		replay = (old.op != op.op) || (old.x != op.x) || (old.y != op.y) || (old.w != op.w) ||
+				 (old.h != op.h) || (old.color != op.color) || (old.bg != op.bg) ||
+				 (old.size != op.size);
+	}
+	if ((pos < list->len) || (old_pos < list->shown_len))
+		replay = true;
+
+	pos = 0;
+	old_pos = 0;
+	while (pos < list->len) {
+		display_list_decode(list->ops, &pos, &op);
+		if (replay) {
+			display_list_draw(&op);
+		} else {
+			display_list_decode(list->shown, &old_pos, &old);
+			if (op.op == DISPLAY_OP_TEXT)
+				display_list_draw_text_diff(&old, &op);
+		}
+	}
+
+	memcpy(list->shown, list->ops, list->len);
+	list->shown_len = list->len;
+	list_shown = list;
+	return true;
+}
@@ -0,0 +1,26 @@
+#include "idle.h"
+#include "display.h"
+#include "cmsis_os.h"
+
+/* Kernel tick of the last button press */
+static volatile uint32_t activity_tick;
+
+/* True while the display sleeps */
+static volatile bool asleep = false;
+
+bool idle_activity(void) {
+	activity_tick = osKernelGetTickCount();
+	return asleep;
+}
+
+bool idle_update(void) {
+	uint32_t timeout = (uint64_t)IDLE_TIMEOUT_MS * osKernelGetTickFreq() / 1000;
+	bool idle = (timeout != 0) && (osKernelGetTickCount() - activity_tick >= timeout);
+
+	if (idle != asleep) {
+		/* The sleeping panel keeps its picture, waking up shows it before the next update */
+		display_sleep(idle);
+		asleep = idle;
+	}
+	return asleep;
+}
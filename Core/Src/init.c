@@ -1,12 +1,15 @@
 #include "init.h"
 
 struct BMP280_HandleTypedef bmp280;
+struct AHT10_HandleTypedef aht10;
+struct CCS811_HandleTypedef ccs811;
 
 uint8_t tft_display_init(void) {
 	/* Initialize the ST7735 display */
 	ST7735_init();
 	/* Fill the display with black color */
 	ST7735_fill(ST7735_BLACK);
+	ST7735_flush();
 	return INIT_OK; /* Return success status */
 }
 
@@ -27,9 +30,11 @@ uint8_t barometr_sensor_init(I2C_HandleTypeDef *_hi2c2) {
 
 uint8_t humidity_sensor_init(I2C_HandleTypeDef *hi2c1) {
 	/* Initialize the AHT10 sensor with its I2C address and handle */
-	if (AHT10_init(AHT10_ADDRESS, hi2c1) != true) {
+	if (AHT10_init(&aht10, AHT10_ADDRESS, hi2c1) != true) {
 		return INIT_AHT10_ERR; /* Return error status if initialization fails */
 	} else {
+		/* Start the first measurement, the first reading cycle collects it */
+		AHT10_measurement_begin(&aht10);
 		return INIT_OK; /* Return success status if initialization succeeds */
 	}
 }
@@ -39,6 +44,8 @@ uint8_t co2_sensor_init(I2C_HandleTypeDef *_hi2c) {
 	if (CCS811_init(_hi2c)) {
 		return INIT_CC811_ERR; /* Return error status if initialization fails */
 	} else {
+		/* Keep the I2C handle for the reads */
+		ccs811.hi2c = _hi2c;
 		return INIT_OK; /* Return success status if initialization succeeds */
 	}
 }
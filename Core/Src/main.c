@@ -23,6 +23,9 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "common.h"
+#include "display.h"
+#include "remote.h"
+#include "idle.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -50,6 +53,7 @@ I2C_HandleTypeDef hi2c3;
 RTC_HandleTypeDef hrtc;
 
 SPI_HandleTypeDef hspi2;
+DMA_HandleTypeDef hdma_spi2_tx;
 
 TIM_HandleTypeDef htim3;
 TIM_HandleTypeDef htim4;
@@ -119,6 +123,7 @@ osStatus_t status;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART1_UART_Init(void);
 static void MX_SPI2_Init(void);
 static void MX_I2C1_Init(void);
@@ -173,6 +178,7 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART1_UART_Init();
   MX_SPI2_Init();
   MX_I2C1_Init();
@@ -242,7 +248,8 @@ int main(void)
   measureTaskHandle = osThreadNew(StartMeasureTask, NULL, &measureTask_attributes);
 
   /* USER CODE BEGIN RTOS_THREADS */
-
+	display_start();
+	remote_start();
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
@@ -720,6 +727,22 @@ static void MX_USART1_UART_Init(void)
 
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream4_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+
+}
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -797,6 +820,11 @@ static void MX_GPIO_Init(void)
 /* USER CODE BEGIN 4 */
 
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+	/* A press on the sleeping display only wakes it, the output task repaints at once */
+	if (idle_activity()) {
+		osThreadFlagsSet(outTaskHandle, 0x01);
+		return;
+	}
 	// if (GPIO_Pin < sizeof(buttonHandlers) / sizeof(ButtonHandler) && buttonHandlers[GPIO_Pin]) {
 	buttonHandlers[GPIO_Pin]();
 	// }
@@ -818,6 +846,12 @@ void StartOutTask(void *argument)
 
 	for (;;) {
 		osThreadFlagsWait(0x01, osFlagsWaitAny, osWaitForever);
+		/* Nothing is drawn while the display sleeps, the LED still follows the values */
+		if (idle_update()) {
+			osThreadFlagsSet(ledTaskHandle, 0x01);
+			sensor_average();
+			continue;
+		}
 		if (!menu) {
       osThreadFlagsSet(ledTaskHandle, 0x01);
 			sensor_out();
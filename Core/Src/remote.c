@@ -0,0 +1,94 @@
+#include "remote.h"
+#include "common.h"
+#include "idle.h"
+#include "ST7735_MIRROR.h"
+#include "cmsis_os.h"
+#include <stdbool.h>
+
+/* Thread flags of the remote task */
+#define REMOTE_FLAG_MIRROR_ON 0x01
+#define REMOTE_FLAG_MIRROR_OFF 0x02
+
+/* Period of the stream polling while mirroring */
+#define REMOTE_POLL_MS 10
+
+extern UART_HandleTypeDef huart1;
+
+/* Serializes the writers of USART1 */
+static osMutexId_t uartMutexHandle;
+static const osMutexAttr_t uartMutex_attributes = {
+	.name = "uartMutex",
+};
+
+/* Definitions for remoteTask */
+static osThreadId_t remoteTaskHandle;
+static const osThreadAttr_t remoteTask_attributes = {
+	.name = "remoteTask",
+	.stack_size = 256 * 4,
+	.priority = (osPriority_t)osPriorityLow,
+};
+
+/* Command byte being received */
+static uint8_t rx_byte;
+
+/* Packets taken from the mirroring stream, sent in one go */
+static uint8_t tx_buf[2 * ST7735_MIRROR_PACKET_MAX];
+
+/**
+ * @brief Function implementing the remoteTask thread
+ * @details Sleeps until a command arrives, polls the mirroring stream while it is on
+ * @param argument Not used
+ */
+static void remote_task(void *argument) {
+	uint32_t flags;
+	uint16_t len;
+	for (;;) {
+		flags = osThreadFlagsWait(REMOTE_FLAG_MIRROR_ON | REMOTE_FLAG_MIRROR_OFF, osFlagsWaitAny,
+				ST7735_mirror_active() ? REMOTE_POLL_MS : osWaitForever);
+		if (!(flags & osFlagsError)) {
+			if (flags & REMOTE_FLAG_MIRROR_OFF)
+				ST7735_mirror(false);
+			if (flags & REMOTE_FLAG_MIRROR_ON) {
+				/* The viewer starts with a whole screen, only changes follow */
+				ST7735_mirror(true);
+				screen_refresh();
+				/* Somebody is looking, a sleeping display wakes up on the next output */
+				idle_activity();
+			}
+		}
+		while ((len = ST7735_mirror_read(tx_buf, sizeof(tx_buf))) > 0)
+			remote_send(tx_buf, len);
+	}
+}
+
+void remote_start(void) {
+	uartMutexHandle = osMutexNew(&uartMutex_attributes);
+	remoteTaskHandle = osThreadNew(remote_task, NULL, &remoteTask_attributes);
+	HAL_UART_Receive_IT(&huart1, &rx_byte, 1);
+}
+
+void remote_send(const uint8_t *data, uint16_t size) {
+	/* Before the scheduler is started there is a single writer */
+	bool lock = (osKernelGetState() == osKernelRunning);
+	if (lock)
+		osMutexAcquire(uartMutexHandle, osWaitForever);
+	HAL_UART_Transmit(&huart1, (uint8_t *)data, size, 1000);
+	if (lock)
+		osMutexRelease(uartMutexHandle);
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+	if (huart != &huart1)
+		return;
+	if (rx_byte == REMOTE_CMD_MIRROR_ON)
+		osThreadFlagsSet(remoteTaskHandle, REMOTE_FLAG_MIRROR_ON);
+	else if (rx_byte == REMOTE_CMD_MIRROR_OFF)
+		osThreadFlagsSet(remoteTaskHandle, REMOTE_FLAG_MIRROR_OFF);
+	HAL_UART_Receive_IT(&huart1, &rx_byte, 1);
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+	/* A framing or overrun error stops the reception, listen again */
+	if (huart == &huart1)
+		HAL_UART_Receive_IT(&huart1, &rx_byte, 1);
+}
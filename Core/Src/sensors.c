@@ -5,54 +5,43 @@
 #define PHT_10LX_R 10000.0F
 #define PHT_GAMMA  0.5F
 
-float get_pressure_readings(struct BMP280_HandleTypedef *dev) {
-	float pressure;
-	/* Read pressure from the BMP280 sensor */
-	if (!BMP280_read_pressure(dev, &pressure)) {
-		return READ_PRESSURE_ERR; /* Return error status if reading fails */
+void get_sensor_readings(struct AHT10_HandleTypedef *aht10_dev, struct BMP280_HandleTypedef *dev,
+		struct CCS811_HandleTypedef *ccs811_dev, sensor_readings_t *readings) {
+	int32_t bmp280_temperature;
+	uint32_t bmp280_pressure;
+
+	/* Start all three buses, the AHT10 measurement started last cycle only needs its frame read */
+	AHT10_process(aht10_dev);
+	BMP280_read_begin(dev);
+	CCS811_read_begin(ccs811_dev);
+
+	/* Join the results */
+	bool bmp280_ok = BMP280_read_end(dev, &bmp280_temperature, &bmp280_pressure);
+	readings->co2_ready = (CCS811_read_end(ccs811_dev, &readings->co2, &readings->tvoc) == HAL_OK);
+	bool aht10_ok = AHT10_measurement_end(aht10_dev);
+
+	/* The next AHT10 conversion runs until the next cycle, nobody waits for it */
+	AHT10_measurement_begin(aht10_dev);
+
+	/* Temperature and humidity come from the same AHT10 frame */
+	if (aht10_ok) {
+		/* Convert humidity to percentage */
+		readings->humidity = aht10_dev->humidity * 100;
+	} else {
+		readings->humidity = READ_HUMIDITY_ERR;
 	}
-	/* Convert pressure to the required unit */
-	/* What is 0.750062? */
-	pressure = pressure * 0.750062;
-	return pressure; /* Return the pressure reading */
-}
-
-float get_temperature_readings(struct BMP280_HandleTypedef *dev) {
-	float bmp280_temperature;
-
-	/* Read temperature from the AHT10 sensor */
-	float aht10_temperature = AHT10_read_temperature(true);
-	/* Read temperature from the BMP280 sensor and check for errors */
-	if (!BMP280_read_temperature(dev, &bmp280_temperature) || (aht10_temperature == AHT10_ERROR)) {
-		return READ_TEMPERATURE_ERR; /* Return error status if reading fails */
+	if (bmp280_ok) {
+		/* What is 0.750062? */
+		readings->pressure = (float)bmp280_pressure / 256 * 0.750062;
+	} else {
+		readings->pressure = READ_PRESSURE_ERR;
 	}
-	/* Calculate the average temperature from both sensors */
-	bmp280_temperature = (aht10_temperature + bmp280_temperature) / 2;
-	return bmp280_temperature; /* Return the temperature reading */
-}
-
-float get_humidity_readings(void) {
-	float humidity = AHT10_read_humidity(true);
-	/* Check for errors in the humidity reading */
-	if (humidity == AHT10_ERROR) {
-		return READ_HUMIDITY_ERR; /* Return error status if reading fails */
+	if (aht10_ok && bmp280_ok) {
+		/* Calculate the average temperature from both sensors */
+		readings->temperature = (aht10_dev->temperature + (float)bmp280_temperature / 100) / 2;
+	} else {
+		readings->temperature = READ_TEMPERATURE_ERR;
 	}
-	humidity *= 100; /* Convert humidity to percentage */
-	return humidity; /* Return the humidity reading */
-}
-
-uint16_t *get_co2_readings(I2C_HandleTypeDef *_hi2c) {
-	uint16_t CO2;
-	uint16_t TVOC;
-	static uint16_t res[2];
-
-	/* Read CO2 and TVOC data from the CCS811 sensor */
-	CCS811_alg_read_data(_hi2c, &CO2, &TVOC);
-
-	res[0] = CO2;  /* Store CO2 reading */
-	res[1] = TVOC; /* Store TVOC reading */
-
-	return res; /* Return the array containing CO2 and TVOC readings */
 }
 
 uint32_t calculate_brightness(ADC_HandleTypeDef *_hadc1) {
@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "main.h"
+#include "I2C_BUS.h"
 
 /* I2C address for the AHT10 sensor. */
 #define AHT10_ADDRESS (0x38 << 1)
@@ -66,94 +67,174 @@
 /* Return value for communication errors. */
 #define AHT10_ERROR 0xFF
 
+/**
+ * @brief States of the non-blocking measurement.
+ */
+typedef enum {
+	AHT10_STATE_IDLE,       /* No measurement started. */
+	AHT10_STATE_CONVERTING, /* Measurement command queued, the sensor is converting. */
+	AHT10_STATE_READING,    /* Data frame being read. */
+	AHT10_STATE_READY,      /* Data frame read, temperature and humidity can be taken. */
+	AHT10_STATE_ERROR,      /* The command or the frame failed, or the data is not valid. */
+} aht10_state_t;
+
+/**
+ * @brief AHT10 Handle Structure definition
+ * @details Every sensor has its own handle, so sensors on different buses or addresses are
+ * measured in parallel.
+ * @param address 8-bit I2C address
+ * @param hi2c I2C handle for communication
+ * @param raw_data Last data frame, the status byte first
+ * @param state State of the non-blocking measurement
+ * @param request Bus request of the non-blocking measurement, running xfer
+ * @param tick Tick at which the current step of the measurement was queued
+ * @param temperature Temperature of the last valid measurement, in degrees Celsius
+ * @param humidity Humidity of the last valid measurement, in percent
+ * @param sample_valid Set once temperature and humidity hold a measurement
+ */
+struct AHT10_HandleTypedef {
+	uint8_t address;
+	I2C_HandleTypeDef *hi2c;
+	uint8_t raw_data[6];
+	aht10_state_t state;
+	i2c_bus_request_t request;
+	i2c_bus_xfer_t xfer;
+	uint32_t tick;
+	float temperature;
+	float humidity;
+	bool sample_valid;
+};
+
 /**
   * @brief Initialize the AHT10 sensor over I2C.
   * @details This function sets up the I2C communication and configures the AHT10 sensor
   * by loading the factory calibration coefficients. It must be called before
   * performing any measurements.
+  * @param device Pointer to the AHT10 Handle structure to set up.
   * @param[in] address The 8-bit I2C address, which should be converted to 7-bit before calling.
-  * @param[in] hi2c1 Pointer to the I2C handle structure.
+  * @param[in] hi2c Pointer to the I2C handle structure.
   * @return True if factory calibration coefficients are loaded successfully, otherwise false.
   */
-bool AHT10_init(uint8_t address, I2C_HandleTypeDef *hi2c1);
+bool AHT10_init(struct AHT10_HandleTypedef *device, uint8_t address, I2C_HandleTypeDef *hi2c);
 
 /**
  * @brief Perform a soft reset of the AHT10 sensor.
  * @details This function resets the AHT10 sensor without powering it off, restoring all registers
  * to their default values. The operation takes approximately 20 milliseconds.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return True if factory calibration coefficients are reloaded successfully, otherwise false.
  */
-bool AHT10_soft_reset(void);
+bool AHT10_soft_reset(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Set the sensor to normal measurement mode.
  * @details This mode allows the sensor to perform measurements at standard intervals.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return True if the mode is set successfully, otherwise false.
  */
-bool AHT10_set_normal_mode(void);
+bool AHT10_set_normal_mode(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Set the sensor to cycle measurement mode for continuous measurement.
  * @details In this mode, the sensor continuously performs measurements at predefined intervals.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return True if the mode is set successfully, otherwise false.
  */
-bool AHT10_set_cycle_mode(void);
+bool AHT10_set_cycle_mode(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Load factory calibration coefficients into the sensor.
  * @details Ensures that the sensor uses its factory-provided calibration for accurate measurements.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return True if calibration coefficients are loaded successfully, otherwise false.
  */
-bool AHT10_enable_factory_cal_coeff(void);
+bool AHT10_enable_factory_cal_coeff(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Read raw data from the AHT10 sensor.
  * @details Retrieves the raw sensor data necessary for temperature and humidity calculations.
+ * Runs a whole measurement with AHT10_measurement_begin(), AHT10_process() and
+ * AHT10_measurement_end(), the calling task sleeps during the conversion.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return A status code indicating success or AHT10_ERROR on failure.
  */
-uint8_t AHT10_read_raw_data(void);
+uint8_t AHT10_read_raw_data(struct AHT10_HandleTypedef *device);
+
+/**
+ * @brief Start a measurement without waiting for it.
+ * @details Queues the measurement command on the I2C bus and returns at once. The sensor then
+ * converts on its own, AHT10_process() collects the data frame once the conversion time is over.
+ * Does nothing while a measurement is converting or being read. Before the kernel is started the
+ * command is sent at once.
+ * @param[in] device Pointer to the AHT10 Handle structure.
+ */
+void AHT10_measurement_begin(struct AHT10_HandleTypedef *device);
+
+/**
+ * @brief Move the measurement on without waiting.
+ * @details Queues the read of the data frame once the conversion time is over and checks it once
+ * read. Meant to be called periodically, by a timer or the measuring task.
+ * @param[in] device Pointer to the AHT10 Handle structure.
+ * @return The state of the measurement.
+ */
+aht10_state_t AHT10_process(struct AHT10_HandleTypedef *device);
+
+/**
+ * @brief Collect the measurement started by AHT10_measurement_begin().
+ * @details Waits for the data frame read queued by AHT10_process(), if any, but never for the
+ * conversion: a measurement still converting is left for the next call. Temperature and humidity
+ * of the frame are kept in the handle until the next valid measurement.
+ * @param[in] device Pointer to the AHT10 Handle structure.
+ * @return True if a frame with a calibrated measurement is available, otherwise false.
+ */
+bool AHT10_measurement_end(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Read the status byte from the sensor over I2C.
  * @details The status byte provides information about the sensor's current state and errors.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @return The status byte on success, or AHT10_ERROR on failure.
  */
-uint8_t AHT10_read_status_byte(void);
+uint8_t AHT10_read_status_byte(struct AHT10_HandleTypedef *device);
 
 /**
  * @brief Check the calibration bit in the status byte.
  * @details Determines whether the factory calibration coefficients are loaded.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @param i2c_read Flag indicating whether to use the last read data or force a new read.
  * @return The calibration bit status or AHT10_ERROR on error.
  * @note 0 indicates calibration coefficients are disabled; 1 indicates they are loaded.
  */
-uint8_t AHT10_get_calibration_bit(bool i2c_read);
+uint8_t AHT10_get_calibration_bit(struct AHT10_HandleTypedef *device, bool i2c_read);
 
 /**
  * @brief Check the busy bit in the status byte.
  * @details Indicates whether the sensor is currently busy performing a measurement.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @param i2c_read Flag indicating whether to use the last read data or force a new read.
  * @return The busy bit status or AHT10_ERROR on failure.
  * @note 0 indicates the sensor is idle; 1 indicates it is busy.
  */
-uint8_t AHT10_get_busy_bit(bool i2c_read);
+uint8_t AHT10_get_busy_bit(struct AHT10_HandleTypedef *device, bool i2c_read);
 
 /**
  * @brief Read the temperature in degrees Celsius.
  * @details Retrieves the current temperature measurement from the sensor.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @param i2c_read Flag indicating whether to use the last read data or force a new read.
  * @return Temperature as a floating point value on success, or AHT10_ERROR on failure.
  * @note Temperature range: -40°C to +80°C. Resolution: 0.01°C. Accuracy: ±0.3°C.
  */
-float AHT10_read_temperature(bool i2c_read);
+float AHT10_read_temperature(struct AHT10_HandleTypedef *device, bool i2c_read);
 
 /**
  * @brief Read the relative humidity in percentage.
  * @details Retrieves the current humidity measurement from the sensor.
+ * @param[in] device Pointer to the AHT10 Handle structure.
  * @param i2c_read Flag indicating whether to use the last read data or force a new read.
  * @return Humidity as a floating point value on success, or AHT10_ERROR on failure.
  * @note Humidity range: 0% to 100%. Resolution: 0.024%. Accuracy: ±2%.
  */
-float AHT10_read_humidity(bool i2c_read);
+float AHT10_read_humidity(struct AHT10_HandleTypedef *device, bool i2c_read);
 
 #endif // __AHT10_h__
@@ -6,6 +6,7 @@
 #define __BMP280_H__
 
 #include "stm32f4xx_hal.h"
+#include "I2C_BUS.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -135,6 +136,7 @@ struct bmp280_params_t {
  * @param dig_T# Temperature compensation coefficients
  * @param dig_P# Pressure compensation coefficients
  * @param hi2c1 I2C handle for communication
+ * @param request Data burst queued by BMP280_read_begin(), reading reg into data through xfer
  */
 struct BMP280_HandleTypedef {
 	uint16_t dig_T1;
@@ -153,6 +155,10 @@ struct BMP280_HandleTypedef {
 	I2C_HandleTypeDef *hi2c1;
 	struct bmp280_params_t params;
 	uint8_t chip_id;
+	i2c_bus_request_t request;
+	i2c_bus_xfer_t xfer;
+	uint8_t reg;
+	uint8_t data[6];
 };
 
 /**
@@ -208,6 +214,35 @@ bool BMP280_is_measuring(struct BMP280_HandleTypedef *device);
 bool BMP280_read_fixed(struct BMP280_HandleTypedef *device, int32_t *temperature,
 		uint32_t *pressure);
 
+/**
+ * @brief Start reading temperature and pressure without waiting for the bus.
+ * @details Queues a burst read of the data registers, so it runs while the sensors on the other
+ * buses are read. BMP280_read_end() collects it.
+ * @param[in] device Pointer to the BMP Handle structure.
+ */
+void BMP280_read_begin(struct BMP280_HandleTypedef *device);
+
+/**
+ * @brief Collect the data read started by BMP280_read_begin() and compensate it.
+ * @param[in] device Pointer to the BMP Handle structure.
+ * @param[in] temperature Pointer to store the temperature value, degrees Celsius times 100.
+ * @param[in] pressure Pointer to store the pressure value, in the format of BMP280_read_fixed().
+ * @return True on success, false otherwise.
+ */
+bool BMP280_read_end(struct BMP280_HandleTypedef *device, int32_t *temperature,
+		uint32_t *pressure);
+
+/**
+ * @brief Read compensated temperature and pressure together.
+ * @details Both values come from a single burst read of the data registers, so one call costs
+ * one bus transaction instead of one per value.
+ * @param[in] device Pointer to the BMP Handle structure.
+ * @param[in] temperature Pointer to store the temperature value, in degrees Celsius.
+ * @param[in] pressure Pointer to store the pressure value, in Pascals.
+ * @return True on success, false otherwise.
+ */
+bool BMP280_read_sample(struct BMP280_HandleTypedef *device, float *temperature, float *pressure);
+
 /**
  * @brief Function to read pressure.
  * @details This function reads and returns the pressure value from the BMP280 sensor.
@@ -7,6 +7,7 @@
 
 #include "stm32f4xx_hal.h"
 #include <stdint.h>
+#include "I2C_BUS.h"
 
 /* I2C address for the CCS811 sensor, shifted left for 7-bit addressing. */
 #define CCS811_ADDRESS (0x5Au) << 1u
@@ -47,6 +48,22 @@
 /* Register to read the hardware ID of the sensor. */
 #define CCS811_HW_ID 0x20
 
+/**
+ * @brief CCS811 Handle Structure definition
+ * @param hi2c I2C handle for communication
+ * @param request Data read queued by CCS811_read_begin(), sending status_reg and result_reg
+ * through xfers and reading the registers into status and result
+ */
+struct CCS811_HandleTypedef {
+	I2C_HandleTypeDef *hi2c;
+	i2c_bus_request_t request;
+	i2c_bus_xfer_t xfers[2];
+	uint8_t status_reg;
+	uint8_t result_reg;
+	uint8_t status;
+	uint8_t result[4];
+};
+
 /**
  * @brief Initializes the CCS811 sensor.
  * @details This function checks if the CCS811 sensor is ready and initializes it by starting the application mode
@@ -67,4 +84,22 @@ uint8_t CCS811_init(I2C_HandleTypeDef *hi2c);
  */
 uint8_t CCS811_alg_read_data(I2C_HandleTypeDef *hi2c, uint16_t *co2, uint16_t *tvoc);
 
+/**
+ * @brief Start reading the CO2 and TVOC data without waiting for the bus.
+ * @details Queues the status and result reads as one request, so they run while the sensors on
+ * the other buses are read. CCS811_read_end() collects them. The request and its buffers live
+ * in the handle, which must outlive the read.
+ * @param device Pointer to the CCS811 device handle.
+ */
+void CCS811_read_begin(struct CCS811_HandleTypedef *device);
+
+/**
+ * @brief Collect the data read started by CCS811_read_begin().
+ * @param device Pointer to the CCS811 device handle.
+ * @param co2 Pointer to store the CO2 concentration value.
+ * @param tvoc Pointer to store the TVOC concentration value.
+ * @return HAL_OK if new data was read, otherwise HAL_ERROR.
+ */
+uint8_t CCS811_read_end(struct CCS811_HandleTypedef *device, uint16_t *co2, uint16_t *tvoc);
+
 #endif   // __CCS811_H__
\ No newline at end of file
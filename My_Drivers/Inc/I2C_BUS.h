@@ -0,0 +1,140 @@
+/**
+ * I2C transaction engine header
+ *
+ * The sensor drivers describe their bus accesses as chains of transfers and hand them to the
+ * engine, which runs them with the interrupt driven HAL functions. Every bus has its own queue:
+ * a request submitted while the bus is busy starts from the completion interrupt of the one in
+ * front of it, so requests on different buses overlap and the submitting tasks sleep on a thread
+ * flag instead of polling the peripheral.
+ *
+ * A transfer with both tx and rx is a register read: tx holds the 1 or 2 byte register address,
+ * sent before a repeated start. A transfer with only tx or only rx is a plain write or read.
+ */
+
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+#include "main.h"
+#include "cmsis_os.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Thread flag reserved by the engine to wake a task when its request completes */
+#ifndef I2C_BUS_FLAG
+#define I2C_BUS_FLAG 0x4000U
+#endif
+
+/* Number of I2C peripherals which can be used at the same time */
+#ifndef I2C_BUS_COUNT
+#define I2C_BUS_COUNT 3
+#endif
+
+/* Longest data of I2C_BUS_write_reg() */
+#define I2C_BUS_WRITE_MAX 8
+
+/* One transfer of a request */
+typedef struct {
+	uint16_t address;  /* 8-bit device address */
+	const uint8_t *tx; /* Bytes to send, NULL when none */
+	uint16_t tx_len;   /* Number of bytes to send */
+	uint8_t *rx;       /* Buffer for the received bytes, NULL when none */
+	uint16_t rx_len;   /* Number of bytes to receive */
+} i2c_bus_xfer_t;
+
+/* A chain of transfers run back to back on one bus, owned by the submitter until completed */
+typedef struct i2c_bus_request {
+	I2C_HandleTypeDef *hi2c;            /* The bus */
+	const i2c_bus_xfer_t *xfers;        /* The transfers */
+	uint8_t count;                      /* Number of transfers */
+	uint8_t index;                      /* Transfer being run */
+	volatile bool done;                 /* Set when the request has completed */
+	volatile HAL_StatusTypeDef status;  /* Result, valid once done */
+	osThreadId_t task;                  /* Task woken on completion */
+	struct i2c_bus_request *next;       /* Next request queued on the same bus */
+} i2c_bus_request_t;
+
+/**
+ * @brief Queues a request on its bus.
+ * @details The request starts at once when the bus is idle. The calling task is woken with
+ * I2C_BUS_FLAG when it completes, so it must be the one calling I2C_BUS_wait(). Before the
+ * kernel is started the request is only recorded and I2C_BUS_wait() runs it with blocking calls.
+ * @param[out] req The request, must stay valid until I2C_BUS_wait() returns.
+ * @param[in] hi2c The bus.
+ * @param[in] xfers The transfers, must stay valid until I2C_BUS_wait() returns.
+ * @param[in] count Number of transfers.
+ */
+void I2C_BUS_submit(i2c_bus_request_t *req, I2C_HandleTypeDef *hi2c, const i2c_bus_xfer_t *xfers,
+		uint8_t count);
+
+/**
+ * @brief Waits for a request to complete.
+ * @details The calling task sleeps meanwhile. A request not completed in time is taken out of
+ * the queue and its bus is reinitialized, so a stuck device can not block the requests behind it.
+ * @param[in] req The request given to I2C_BUS_submit().
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return HAL_OK on success, HAL_ERROR on a bus error or a NACK, HAL_TIMEOUT on timeout.
+ */
+HAL_StatusTypeDef I2C_BUS_wait(i2c_bus_request_t *req, uint32_t timeout);
+
+/**
+ * @brief Runs a chain of transfers and waits for the result.
+ * @param[in] hi2c The bus.
+ * @param[in] xfers The transfers.
+ * @param[in] count Number of transfers.
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return The status returned by I2C_BUS_wait().
+ */
+HAL_StatusTypeDef I2C_BUS_transfer(I2C_HandleTypeDef *hi2c, const i2c_bus_xfer_t *xfers,
+		uint8_t count, uint32_t timeout);
+
+/**
+ * @brief Sends bytes to a device.
+ * @param[in] hi2c The bus.
+ * @param[in] address The 8-bit device address.
+ * @param[in] data The bytes.
+ * @param[in] len Number of bytes.
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return The status returned by I2C_BUS_wait().
+ */
+HAL_StatusTypeDef I2C_BUS_write(I2C_HandleTypeDef *hi2c, uint16_t address, const uint8_t *data,
+		uint16_t len, uint32_t timeout);
+
+/**
+ * @brief Receives bytes from a device.
+ * @param[in] hi2c The bus.
+ * @param[in] address The 8-bit device address.
+ * @param[out] data Buffer for the bytes.
+ * @param[in] len Number of bytes.
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return The status returned by I2C_BUS_wait().
+ */
+HAL_StatusTypeDef I2C_BUS_read(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data,
+		uint16_t len, uint32_t timeout);
+
+/**
+ * @brief Reads consecutive registers of a device with an 8-bit register address.
+ * @param[in] hi2c The bus.
+ * @param[in] address The 8-bit device address.
+ * @param[in] reg The first register.
+ * @param[out] data Buffer for the bytes.
+ * @param[in] len Number of bytes.
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return The status returned by I2C_BUS_wait().
+ */
+HAL_StatusTypeDef I2C_BUS_read_reg(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t reg,
+		uint8_t *data, uint16_t len, uint32_t timeout);
+
+/**
+ * @brief Writes consecutive registers of a device with an 8-bit register address.
+ * @param[in] hi2c The bus.
+ * @param[in] address The 8-bit device address.
+ * @param[in] reg The first register.
+ * @param[in] data The bytes.
+ * @param[in] len Number of bytes, at most I2C_BUS_WRITE_MAX.
+ * @param[in] timeout Longest wait in milliseconds.
+ * @return The status returned by I2C_BUS_wait(), HAL_ERROR when len is too large.
+ */
+HAL_StatusTypeDef I2C_BUS_write_reg(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t reg,
+		const uint8_t *data, uint16_t len, uint32_t timeout);
+
+#endif /* __I2C_BUS_H__ */
@@ -6,7 +6,48 @@
 #define __ST7735_H__
 
 #include "main.h"
+#include "ST7735_FONTS.h"
 #include <stm32f4xx_hal.h>
+#include <stdbool.h>
+
+/* Draw into a RAM framebuffer and push only changed regions with ST7735_flush() */
+#ifndef ST7735_USE_FRAMEBUFFER
+#define ST7735_USE_FRAMEBUFFER 0
+#endif
+
+/* Framebuffer bits per pixel: 16 stores RGB565 (40 KB), 8 or 4 store palette indices (20/10 KB) */
+#ifndef ST7735_FB_BPP
+#define ST7735_FB_BPP 16
+#endif
+
+#if (ST7735_FB_BPP != 16) && (ST7735_FB_BPP != 8) && (ST7735_FB_BPP != 4)
+#error "ST7735_FB_BPP must be 16, 8 or 4"
+#endif
+
+/* Maximum number of dirty rectangles tracked between two flushes */
+#ifndef ST7735_DIRTY_RECTS
+#define ST7735_DIRTY_RECTS 8
+#endif
+
+/* Stream pixel data with DMA (hspi2 TX on DMA1 Stream4) instead of polling the SPI */
+#ifndef ST7735_USE_DMA
+#define ST7735_USE_DMA 1
+#endif
+
+/* Copy the display traffic into a compressed stream for a remote viewer, see ST7735_MIRROR.h */
+#ifndef ST7735_USE_MIRROR
+#define ST7735_USE_MIRROR 1
+#endif
+
+/* Number of expanded glyphs kept by the proportional text engine, 4 + 4 * height bytes each */
+#ifndef ST7735_GLYPH_CACHE
+#define ST7735_GLYPH_CACHE 12
+#endif
+
+/* Thread flag reserved by the driver to wake the drawing task when a DMA transfer completes */
+#ifndef ST7735_DMA_FLAG
+#define ST7735_DMA_FLAG 0x8000U
+#endif
 
 /* Width of the display in pixels for the 1.44" and mini versions */
 #define ST7735_TFTWIDTH_128 128
@@ -16,6 +57,9 @@
 #define ST7735_TFTHEIGHT_128 128
 /* Height of the display in pixels for the 1.8" and mini versions */
 #define ST7735_TFTHEIGHT_160 160
+/* Number of lines of the display frame memory, the scroll areas always add up to it. The 1.8"
+ * module runs the controller in its 128x160 memory mode, MADCTL MY mirrors rows over these lines */
+#define ST7735_MEMORY_LINES 160
 
 /* Special signifier used in command lists to introduce a delay */
 #define ST_CMD_DELAY 0x80
@@ -57,12 +101,16 @@
 
 /* Partial Area command */
 #define ST77XX_PTLAR 0x30
+/* Vertical Scrolling Definition command */
+#define ST77XX_VSCRDEF 0x33
 /* Tearing Effect Line OFF command */
 #define ST77XX_TEOFF 0x34
 /* Tearing Effect Line ON command */
 #define ST77XX_TEON 0x35
 /* Memory Access Control command */
 #define ST77XX_MADCTL 0x36
+/* Vertical Scrolling Start Address command */
+#define ST77XX_VSCRSADD 0x37
 /* Interface Pixel Format command */
 #define ST77XX_COLMOD 0x3A
 
@@ -180,6 +228,56 @@
 /* 16-bit color: orange (alias) */
 #define ST7735_ORANGE ST77XX_ORANGE
 
+/**
+ * @brief SPI traffic counters of the display driver.
+ * @param transactions Number of HAL SPI transmit calls (blocking or DMA)
+ * @param bytes Number of bytes sent to the display
+ * @param commands Number of command bytes sent to the display
+ * @param commands_saved Number of CASET/RASET/RAMWR commands skipped thanks to the window cache
+ */
+typedef struct {
+	uint32_t transactions;
+	uint32_t bytes;
+	uint32_t commands;
+	uint32_t commands_saved;
+} st7735_stats_t;
+
+/* Image stored as 16-bit words: repeat (bit 15 set) or literal headers with (word & 0x7FFF) + 1
+ * pixels, followed by one RGB565 pixel for a repeat or by the literal RGB565 pixels */
+#define ST7735_IMAGE_RLE565 0
+/* Image stored as byte run lengths alternating between background and ink, starting with
+ * background, drawn with the colors passed to ST7735_image() */
+#define ST7735_IMAGE_RLE1 1
+
+/**
+ * @brief Run-length encoded image, generated by Tools/img2rle.py.
+ * @param w, h Dimensions of the image
+ * @param format ST7735_IMAGE_RLE565 or ST7735_IMAGE_RLE1
+ * @param data Encoded runs, row by row: uint16_t words for RLE565, bytes for RLE1
+ */
+typedef struct {
+	uint16_t w, h;
+	uint8_t format;
+	const void *data;
+} st7735_image_t;
+
+/* Size of the text of the overlay banner, including the terminating zero */
+#define ST7735_OVERLAY_TEXT_LEN 22
+
+/**
+ * @brief Banner shown above the framebuffer content, see ST7735_overlay().
+ * @param x, y Top-left corner
+ * @param w, h Dimensions
+ * @param color Text color
+ * @param bg Background color
+ * @param text Text centered in the banner in the 5x7 font, ends at the first '\r' or '\n'
+ */
+typedef struct {
+	int16_t x, y, w, h;
+	uint16_t color, bg;
+	char text[ST7735_OVERLAY_TEXT_LEN];
+} st7735_overlay_t;
+
 /**
  * @brief Initializes the LCD display.
  * @details Sets up the hardware interface and configures the display parameters.
@@ -195,6 +293,57 @@ int ST7735_init(void);
  */
 int ST7735_set_rotation(int m);
 
+/**
+ * @brief Defines the hardware scrolling band.
+ * @details The display scrolls a band of its frame memory along the 160-pixel side of the panel:
+ * vertically in rotations 0 and 2, horizontally in rotations 1 and 3. Content outside the band
+ * stays in place. The band starts unscrolled. Lines of the band are numbered from 0 along the
+ * display coordinates in every rotation, use ST7735_scroll_coord() to find where a line is drawn.
+ * @param start Display coordinate of the band along the scroll axis.
+ * @param length Number of lines in the band, 0 ends scrolling.
+ */
+void ST7735_scroll_area(int16_t start, uint16_t length);
+
+/**
+ * @brief Scrolls the band so that the given line is shown at its start.
+ * @details Only the scroll start address is sent, the frame memory is untouched. In framebuffer
+ * mode the pending changes are flushed first so that lines drawn before the call show up together
+ * with the scroll. The line before the first shown one ends up at the bottom or right of the band.
+ * In rotations 0 and 1, where MADCTL MY mirrors the frame memory lines, the start address is
+ * counted from the other end of the band.
+ * @param line Line of the band, taken modulo the band length.
+ */
+void ST7735_scroll(uint16_t line);
+
+/**
+ * @brief Locates a block of lines of the scrolling band.
+ * @details Drawing at the returned coordinate writes the frame memory lines of the block, wherever
+ * the band is currently scrolled to.
+ * @param line First line of the block, taken modulo the band length.
+ * @param count Number of lines in the block, it must not wrap past the end of the band.
+ * @return Lowest display coordinate along the scroll axis covered by the block.
+ */
+int16_t ST7735_scroll_coord(uint16_t line, uint16_t count);
+
+/**
+ * @brief Tells the direction of the scroll axis.
+ * @return True if the band scrolls along x (rotations 1 and 3), false if along y.
+ */
+bool ST7735_scroll_horizontal(void);
+
+/**
+ * @brief Starts a batch of drawing operations.
+ * @details Takes the screen lock and selects the display once. Drawing calls made by the same task
+ * until ST7735_end() skip their own locking and keep the chip select asserted. Batches may be
+ * nested, other tasks wait until the outermost ST7735_end().
+ */
+void ST7735_begin(void);
+
+/**
+ * @brief Ends a batch of drawing operations started with ST7735_begin().
+ */
+void ST7735_end(void);
+
 /**
  * @brief Draws a pixel on the display.
  * @details Sets a single pixel to the specified color at the given coordinates.
@@ -253,6 +402,31 @@ void ST7735_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color
  */
 void ST7735_fill(uint16_t color);
 
+/**
+ * @brief Draws an image on the display.
+ * @details Copies a block of RGB565 pixels stored row by row, only the visible part is drawn.
+ * @param x The x-coordinate of the top-left corner.
+ * @param y The y-coordinate of the top-left corner.
+ * @param w The width of the image.
+ * @param h The height of the image.
+ * @param pixels The image pixels, w * h values.
+ */
+void ST7735_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+
+/**
+ * @brief Draws a run-length encoded image.
+ * @details The runs are streamed from the image data without decompressing it: repeats become
+ * solid fills and literals are sent straight from flash. A fully visible opaque image takes one
+ * address window, a clipped one a window per row and run.
+ * @param x The x-coordinate of the top-left corner.
+ * @param y The y-coordinate of the top-left corner.
+ * @param image The image, its data must stay valid while it is drawn.
+ * @param color The ink color of a 1-bit image, unused for RGB565 images.
+ * @param bg The background color of a 1-bit image, equal to color to leave the background
+ * untouched. Unused for RGB565 images.
+ */
+void ST7735_image(int16_t x, int16_t y, const st7735_image_t *image, uint16_t color, uint16_t bg);
+
 /**
  * @brief Draws a line between two points on the display.
  * @details Uses Bresenham's algorithm to draw a line with the specified color.
@@ -354,4 +528,95 @@ void ST7735_putchar_config(int16_t x, int16_t y, char c, uint16_t color, uint16_
 void ST7735_print_config(int16_t x, int16_t y, char *text, uint16_t color, uint16_t bg,
 		uint8_t size_x, uint8_t size_y);
 
+/**
+ * @brief Draws a single line of text in a proportional font.
+ * @details Glyphs are expanded from their compressed runs into a small cache. Opaque text is sent
+ * with one address window per group of up to ST7735_GLYPH_CACHE glyphs, transparent text draws
+ * only the ink runs. The text ends at the first '\r' or '\n', characters missing from the font
+ * are drawn as '?'.
+ * @param x The x-coordinate of the text's top-left corner.
+ * @param y The y-coordinate of the text's top-left corner.
+ * @param text The string to draw.
+ * @param font The font to use.
+ * @param color The color of the text.
+ * @param bg The background color of the text, equal to color for transparent text.
+ * @return The x-coordinate following the last glyph.
+ */
+int16_t ST7735_text(int16_t x, int16_t y, const char *text, const st7735_font_t *font,
+		uint16_t color, uint16_t bg);
+
+/**
+ * @brief Measures a single line of text in a proportional font.
+ * @param text The string to measure, up to the first '\r' or '\n'.
+ * @param font The font to use.
+ * @return Width of the text in pixels.
+ */
+int16_t ST7735_text_width(const char *text, const st7735_font_t *font);
+
+/**
+ * @brief Pushes the changed regions of the framebuffer to the display.
+ * @details Every dirty rectangle is sent with a single address window. Full-width rectangles
+ * go out in one SPI transfer. Otherwise as many rows as fit are gathered in a line buffer and
+ * sent together, so a one pixel column takes one transfer and only rows wider than half the line
+ * buffer take one transfer each. A palettized framebuffer is expanded to RGB565 on the way. Rows
+ * crossing the overlay banner get it composited in the line buffer.
+ * @note Does nothing when ST7735_USE_FRAMEBUFFER is disabled, drawing is immediate then.
+ */
+void ST7735_flush(void);
+
+/**
+ * @brief Loads the palette of a palettized framebuffer.
+ * @details By default the palette holds black and white, every other color takes the next free
+ * entry when it is first drawn and maps to the closest entry once the palette is full. Loading
+ * the palette up front keeps the index order fixed. Pixels keep their indices, so drawn pixels
+ * change color when their entry is replaced; the whole screen is resent on the next flush.
+ * @param colors RGB565 colors of the indices, starting at index 0.
+ * @param count Number of colors, at most 1 << ST7735_FB_BPP.
+ * @note Does nothing unless the framebuffer is enabled with ST7735_FB_BPP below 16.
+ */
+void ST7735_set_palette(const uint16_t *colors, uint16_t count);
+
+/**
+ * @brief Shows, replaces or removes the overlay banner.
+ * @details The banner is a layer above the framebuffer: drawing goes on underneath it unchanged
+ * and ST7735_flush() composites the banner into the rows it sends. Its colors bypass the palette.
+ * Only the area of the old and of the new banner is resent on the next flush, what a removed
+ * banner covered comes back from the framebuffer.
+ * @param overlay The banner, copied, or NULL to remove it.
+ * @note Does nothing unless ST7735_USE_FRAMEBUFFER is enabled.
+ */
+void ST7735_overlay(const st7735_overlay_t *overlay);
+
+/**
+ * @brief Turns the mirroring stream on or off.
+ * @details Turning it on sends the rotation and the scrolling state again and opens the next
+ * address window from scratch, so a viewer starting from nothing decodes every later write. With
+ * the framebuffer the whole screen follows on the next flush, otherwise the caller has to redraw
+ * it. Turning it off never waits for the screen lock.
+ * @param on True to start mirroring, false to stop it.
+ * @note Does nothing unless ST7735_USE_MIRROR is enabled.
+ */
+void ST7735_mirror(bool on);
+
+/**
+ * @brief Puts the display to sleep or wakes it up.
+ * @details Sleeping blanks the panel and stops its booster and oscillator, while the frame memory
+ * keeps its content and can still be written. Waking up shows that content again at once. Each
+ * transition holds the screen lock for the 120 ms the controller needs before the next one.
+ * @param on True to sleep, false to wake up.
+ */
+void ST7735_sleep(bool on);
+
+/**
+ * @brief Reads the SPI traffic counters.
+ * @param[out] stats Pointer to store the counters.
+ */
+void ST7735_get_stats(st7735_stats_t *stats);
+
+/**
+ * @brief Resets the SPI traffic counters.
+ * @details Call before a refresh and read the counters after it to measure its cost.
+ */
+void ST7735_reset_stats(void);
+
 #endif /* __ST7735_H__ */
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ * TFT display proportional fonts header
+ */
+
+#ifndef __ST7735_FONTS_H__
+#define __ST7735_FONTS_H__
+
+#include <stdint.h>
+
+/* Tallest and widest glyph supported by the text engine, a glyph row is kept in 32 bits */
+#define ST7735_GLYPH_MAX_SIZE 32
+
+/**
+ * @brief Glyph of a proportional font.
+ * @param offset Offset of the glyph runs in the font bitmap
+ * @param width Advance width in pixels, spacing to the next glyph included
+ */
+typedef struct {
+	uint16_t offset;
+	uint8_t width;
+} st7735_glyph_t;
+
+/**
+ * @brief Proportional font.
+ * @details Glyphs are stored row by row as run lengths of alternating background and ink pixels,
+ * starting with background. Fonts are generated by Tools/fontgen.py.
+ * @param bitmap Runs of all glyphs
+ * @param glyphs Glyph table, one entry per character from first to last
+ * @param first, last Character range of the font
+ * @param height Height of every glyph in pixels
+ */
+typedef struct {
+	const uint8_t *bitmap;
+	const st7735_glyph_t *glyphs;
+	uint8_t first, last;
+	uint8_t height;
+} st7735_font_t;
+
+/* Classic 5x8 font with trimmed spacing, 8 px high */
+extern const st7735_font_t font_prop8;
+/* Smoothed 2x font, 16 px high */
+extern const st7735_font_t font_prop16;
+/* Smoothed 3x font, 24 px high */
+extern const st7735_font_t font_prop24;
+
+#endif /* __ST7735_FONTS_H__ */
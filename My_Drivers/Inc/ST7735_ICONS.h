@@ -0,0 +1,18 @@
+/**
+ * Images for the ST7735 image blitter header
+ * Generated by Tools/img2rle.py, do not edit.
+ */
+
+#ifndef __ST7735_ICONS_H__
+#define __ST7735_ICONS_H__
+
+#include "ST7735.h"
+
+/* 12x12 1-bit image, 53 bytes */
+extern const st7735_image_t icon_comfort_good;
+/* 12x12 1-bit image, 53 bytes */
+extern const st7735_image_t icon_comfort_bad;
+/* 12x12 1-bit image, 13 bytes */
+extern const st7735_image_t icon_co2;
+
+#endif /* __ST7735_ICONS_H__ */
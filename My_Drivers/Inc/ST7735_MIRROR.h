@@ -0,0 +1,100 @@
+/**
+ * TFT display mirroring stream header
+ *
+ * While mirroring is on, everything the driver sends to the display is also encoded into a
+ * compressed stream that a remote viewer decodes with its own model of the controller, so it
+ * shows the same picture as the panel. After the controller state is sent again by
+ * ST7735_mirror(true), only what is drawn from then on travels, i.e. the changed regions.
+ *
+ * The stream is a sequence of packets, which can be mixed with ASCII text on the same link:
+ *   0xA5, length, payload (length bytes), XOR of the payload bytes
+ * The payload is a sequence of operations, multi-byte values are big-endian:
+ *   ST7735_MIRROR_OP_COMMAND, command byte         command, ends the previous one
+ *   ST7735_MIRROR_OP_DATA, n, n bytes              argument bytes of the command
+ *   ST7735_MIRROR_OP_RUN, count (2 bytes), color   count pixels of one RGB565 color
+ *   ST7735_MIRROR_OP_PIXELS, n, n colors           n RGB565 pixels
+ */
+
+#ifndef __ST7735_MIRROR_H__
+#define __ST7735_MIRROR_H__
+
+#include "ST7735.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Size of the buffer holding the packets not read yet, in bytes */
+#ifndef ST7735_MIRROR_BUF_SIZE
+#define ST7735_MIRROR_BUF_SIZE 4096
+#endif
+
+/* First byte of a packet, never found in ASCII text */
+#define ST7735_MIRROR_SYNC 0xA5
+
+/* Largest payload of a packet */
+#define ST7735_MIRROR_PAYLOAD_MAX 255
+
+/* Largest packet: sync, length, payload and check bytes */
+#define ST7735_MIRROR_PACKET_MAX (ST7735_MIRROR_PAYLOAD_MAX + 3)
+
+/* Operation codes of the payload */
+#define ST7735_MIRROR_OP_COMMAND 0x01
+#define ST7735_MIRROR_OP_DATA 0x02
+#define ST7735_MIRROR_OP_RUN 0x03
+#define ST7735_MIRROR_OP_PIXELS 0x04
+
+/**
+ * @brief Starts encoding the display traffic.
+ * @details Called by ST7735_mirror() with the screen lock held, so no traffic is being encoded.
+ */
+void ST7735_mirror_start(void);
+
+/**
+ * @brief Stops encoding the display traffic.
+ * @details Does not wait for the screen lock: a drawing task waiting for free buffer space drops
+ * its packet and goes on. Packets already in the buffer can still be read.
+ */
+void ST7735_mirror_stop(void);
+
+/**
+ * @brief Tells whether the display traffic is encoded.
+ */
+bool ST7735_mirror_active(void);
+
+/**
+ * @brief Takes whole packets out of the stream buffer.
+ * @param buf Buffer receiving the packets.
+ * @param size Size of buf, at least ST7735_MIRROR_PACKET_MAX to always make progress.
+ * @return Number of bytes stored in buf, 0 when no packet is waiting.
+ */
+uint16_t ST7735_mirror_read(uint8_t *buf, uint16_t size);
+
+/**
+ * @brief Encodes a command byte sent to the display.
+ * @param command The command.
+ */
+void ST7735_mirror_command(uint8_t command);
+
+/**
+ * @brief Encodes command argument bytes sent to the display.
+ * @param data The bytes.
+ * @param size Number of bytes.
+ */
+void ST7735_mirror_data(const uint8_t *data, size_t size);
+
+/**
+ * @brief Encodes pixels sent to the display.
+ * @param pixels The RGB565 pixels.
+ * @param count Number of pixels.
+ * @param repeat True if the first pixel is sent count times.
+ */
+void ST7735_mirror_pixels(const uint16_t *pixels, uint32_t count, bool repeat);
+
+/**
+ * @brief Ends a batch of display traffic.
+ * @details Called when the display is deselected: the packet being built is queued for reading,
+ * so a batch never waits for the next one.
+ */
+void ST7735_mirror_end(void);
+
+#endif /* __ST7735_MIRROR_H__ */
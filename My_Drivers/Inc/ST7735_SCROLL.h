@@ -0,0 +1,98 @@
+/**
+ * TFT display scrolling console and strip chart header
+ */
+
+#ifndef __ST7735_SCROLL_H__
+#define __ST7735_SCROLL_H__
+
+#include "ST7735.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Height of a console text row in pixels */
+#define ST7735_CONSOLE_ROW 8
+
+/**
+ * @brief Scrolling text console.
+ * @details Lives in the hardware scrolling band: a new row is written over the oldest one and the
+ * band is scrolled by one row, the other rows are not redrawn. The display has a single scrolling
+ * band, so only one console or strip chart can be active at a time. Meant for rotations 0 and 2.
+ * @param y Top of the console
+ * @param lines Height of the console in pixels
+ * @param line Band line where the next row is written
+ * @param color Text color
+ * @param bg Background color
+ */
+typedef struct {
+	int16_t y;
+	uint16_t lines;
+	uint16_t line;
+	uint16_t color, bg;
+} st7735_console_t;
+
+/**
+ * @brief Scrolling strip chart.
+ * @details Lives in the hardware scrolling band: every sample is drawn as one line across the band
+ * and the band is scrolled by one line. In rotations 1 and 3 the samples are columns and the values
+ * grow upwards, in rotations 0 and 2 the samples are rows and the values grow to the right.
+ * @param start Position of the chart along the scroll axis
+ * @param length Number of samples shown
+ * @param line Band line where the next sample is drawn
+ * @param min, max Value range mapped across the chart
+ * @param color Trace color
+ * @param bg Background color
+ * @param last Position of the previous sample across the chart, -1 before the first sample
+ */
+typedef struct {
+	int16_t start;
+	uint16_t length;
+	uint16_t line;
+	int32_t min, max;
+	uint16_t color, bg;
+	int16_t last;
+} st7735_strip_t;
+
+/**
+ * @brief Sets up a scrolling console and clears it.
+ * @param console Pointer to the console to initialize.
+ * @param y The y-coordinate of the top of the console.
+ * @param rows Number of text rows.
+ * @param color The color of the text.
+ * @param bg The background color.
+ */
+void ST7735_console_init(st7735_console_t *console, int16_t y, uint8_t rows, uint16_t color,
+		uint16_t bg);
+
+/**
+ * @brief Appends text to the console.
+ * @details Every line of the text, separated by '\n', takes a new row at the bottom of the console
+ * and scrolls the older rows up, a trailing '\n' does not add an empty row. A row costs one row of
+ * text pixels and one scroll command.
+ * @param console Pointer to the console.
+ * @param text The text to append, '\r' is ignored.
+ */
+void ST7735_console_print(st7735_console_t *console, const char *text);
+
+/**
+ * @brief Sets up a scrolling strip chart and clears it.
+ * @param strip Pointer to the chart to initialize.
+ * @param start Position of the chart along the scroll axis.
+ * @param length Number of samples shown.
+ * @param min The value drawn at the bottom or left edge.
+ * @param max The value drawn at the top or right edge.
+ * @param color The color of the trace.
+ * @param bg The background color.
+ */
+void ST7735_strip_init(st7735_strip_t *strip, int16_t start, uint16_t length, int32_t min,
+		int32_t max, uint16_t color, uint16_t bg);
+
+/**
+ * @brief Adds a sample to the strip chart.
+ * @details The oldest sample line is redrawn with the new one, joined to the previous sample, and
+ * the chart is scrolled by one line.
+ * @param strip Pointer to the chart.
+ * @param value The sample, clamped to the chart range.
+ */
+void ST7735_strip_add(st7735_strip_t *strip, int32_t value);
+
+#endif /* __ST7735_SCROLL_H__ */
@@ -0,0 +1,140 @@
+/**
+ * TFT display text widgets header
+ */
+
+#ifndef __ST7735_WIDGET_H__
+#define __ST7735_WIDGET_H__
+
+#include "ST7735.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Maximum number of characters a widget can hold, including the terminating zero */
+#ifndef ST7735_WIDGET_MAX_LEN
+#define ST7735_WIDGET_MAX_LEN 32
+#endif
+
+/* Maximum width of a chart widget in pixels, one sample per column */
+#ifndef ST7735_CHART_MAX_W
+#define ST7735_CHART_MAX_W ST7735_TFTWIDTH_128
+#endif
+
+/* Marks a chart column without sample */
+#define ST7735_CHART_EMPTY 0xFF
+
+/**
+ * @brief Retained text widget.
+ * @details Remembers the text shown at a fixed position so that an update only repaints the
+ * character cells which differ from the previous text.
+ * @param x, y Top-left corner of the first character cell
+ * @param color Text color
+ * @param bg Background color, must differ from the text color
+ * @param size_x, size_y Text magnification
+ * @param cells Number of character cells, longer text is cut
+ * @param valid True while text matches what is on the screen
+ * @param text Text currently shown
+ */
+typedef struct {
+	int16_t x, y;
+	uint16_t color, bg;
+	uint8_t size_x, size_y;
+	uint8_t cells;
+	bool valid;
+	char text[ST7735_WIDGET_MAX_LEN];
+} st7735_widget_t;
+
+/**
+ * @brief Retained sweep chart widget.
+ * @details Samples are drawn left to right, the cursor wraps to the left edge when it reaches
+ * the right one. Every sample is drawn as a vertical span joining it to the previous sample, and
+ * the span of the column ahead of the cursor is erased, leaving a gap between the newest and the
+ * oldest samples. The rest of the plot is never redrawn.
+ * @param x, y Top-left corner of the plot
+ * @param w, h Dimensions of the plot, w is 1 .. ST7735_CHART_MAX_W and h 1 .. 255
+ * @param min, max Value range, min is drawn at the bottom row and max at the top one
+ * @param color Trace color
+ * @param bg Background color
+ * @param head Column of the next sample
+ * @param last Row of the previous sample, ST7735_CHART_EMPTY before the first one
+ * @param valid True while the plot matches what is on the screen
+ * @param top, bottom Rows of the span drawn in every column, ST7735_CHART_EMPTY when empty
+ */
+typedef struct {
+	int16_t x, y;
+	uint8_t w, h;
+	int32_t min, max;
+	uint16_t color, bg;
+	uint8_t head;
+	uint8_t last;
+	bool valid;
+	uint8_t top[ST7735_CHART_MAX_W];
+	uint8_t bottom[ST7735_CHART_MAX_W];
+} st7735_chart_t;
+
+/**
+ * @brief Registers a text widget.
+ * @details Nothing is drawn until the first ST7735_widget_set_text() call.
+ * @param widget Pointer to the widget to initialize.
+ * @param x The x-coordinate of the first character cell.
+ * @param y The y-coordinate of the first character cell.
+ * @param color The color of the text.
+ * @param bg The background color of the text.
+ * @param size_x The horizontal size multiplier.
+ * @param size_y The vertical size multiplier.
+ * @param cells The number of character cells, at most ST7735_WIDGET_MAX_LEN - 1, 0 for the
+ * maximum. Keeps the text clear of whatever is drawn right of the widget.
+ */
+void ST7735_widget_init(st7735_widget_t *widget, int16_t x, int16_t y, uint16_t color, uint16_t bg,
+		uint8_t size_x, uint8_t size_y, uint8_t cells);
+
+/**
+ * @brief Updates the text of a widget.
+ * @details Compares the new text with the shown one and repaints only the character cells that
+ * changed. Cells left over from a longer previous text are cleared. The text ends at the first
+ * '\r' or '\n' and is truncated to the cells of the widget.
+ * @param widget Pointer to the widget.
+ * @param text The new text.
+ * @return Number of character cells repainted.
+ */
+uint8_t ST7735_widget_set_text(st7735_widget_t *widget, const char *text);
+
+/**
+ * @brief Forces a full repaint of the widget on its next update.
+ * @details Call after the area under the widget was drawn over, e.g. by a screen clear.
+ * @param widget Pointer to the widget.
+ */
+void ST7735_widget_invalidate(st7735_widget_t *widget);
+
+/**
+ * @brief Registers a chart widget.
+ * @details The chart starts empty, nothing is drawn until the first ST7735_chart_add() call.
+ * @param chart Pointer to the chart to initialize.
+ * @param x The x-coordinate of the top-left corner of the plot.
+ * @param y The y-coordinate of the top-left corner of the plot.
+ * @param w The width of the plot, clamped to 1 .. ST7735_CHART_MAX_W.
+ * @param h The height of the plot, at least 1.
+ * @param min The value drawn at the bottom row.
+ * @param max The value drawn at the top row.
+ * @param color The color of the trace.
+ * @param bg The background color of the plot.
+ */
+void ST7735_chart_init(st7735_chart_t *chart, int16_t x, int16_t y, uint8_t w, uint8_t h,
+		int32_t min, int32_t max, uint16_t color, uint16_t bg);
+
+/**
+ * @brief Adds a sample to a chart widget.
+ * @details Draws the span of the new sample and erases the span ahead of the cursor, two short
+ * column fills. After an invalidation the whole plot is redrawn from the retained spans first.
+ * @param chart Pointer to the chart.
+ * @param value The sample, clamped to the chart range.
+ */
+void ST7735_chart_add(st7735_chart_t *chart, int32_t value);
+
+/**
+ * @brief Forces a full repaint of the chart on its next sample.
+ * @details Call after the area under the chart was drawn over, e.g. by a screen clear.
+ * @param chart Pointer to the chart.
+ */
+void ST7735_chart_invalidate(st7735_chart_t *chart);
+
+#endif /* __ST7735_WIDGET_H__ */
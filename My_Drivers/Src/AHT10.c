@@ -4,6 +4,7 @@
 
 #include "AHT10.h"
 #include "main.h"
+#include "cmsis_os.h"
 /* Define bit position for calibration bit in the status byte */
 #define CALIBRATION_BIT_SHIFT 3 /* Bit position for calibration bit */
 
@@ -39,58 +40,61 @@
 #define AHT10_HUMIDITY_MIN 0   /* Minimum humidity value */
 #define AHT10_HUMIDITY_MAX 100 /* Maximum humidity value */
 
-/* Pointer to the I2C handle structure used for communication. */
-I2C_HandleTypeDef *_hi2c1;
-
-/* The 7-bit I2C address of the AHT10 sensor. */
-uint8_t _address;
-
-/* Buffer to store raw data from the sensor, initialized with default error value. */
-uint8_t raw_data_buffer[6] = {AHT10_ERROR, 0, 0, 0, 0, 0};
-
-/* Result of the last I2C communication operation. */
 /**
- * Global (not static) variable for saving results for HAL operations?
- * Is it safe? :0
- * I don't see that you use this variable other that check if it is HAL_OK or not.
- * Why not just remove this variable and not create it for every function? Like in CCS811 drivers
+ * @brief Waits without keeping the CPU busy once the kernel runs.
+ * @details Before the kernel is started nothing else could run, the delay is polled.
+ * @param ms Delay in milliseconds.
  */
-HAL_StatusTypeDef result;
+static void AHT10_delay(uint32_t ms) {
+	if (osKernelGetState() == osKernelRunning) {
+		osDelay(ms);
+	} else {
+		HAL_Delay(ms);
+	}
+}
+
+/* Measurement command queued by AHT10_measurement_begin() */
+static const uint8_t measurement_cmd[3] = {
+		AHT10_START_MEASURMENT_CMD, AHT10_DATA_MEASURMENT_CMD, AHT10_DATA_NOP};
 
-bool AHT10_init(uint8_t address, I2C_HandleTypeDef *hi2c1) {
-	_address = address;
-	_hi2c1 = hi2c1;
+bool AHT10_init(struct AHT10_HandleTypedef *device, uint8_t address, I2C_HandleTypeDef *hi2c) {
+	device->address = address;
+	device->hi2c = hi2c;
+	device->raw_data[0] = AHT10_ERROR;
+	device->state = AHT10_STATE_IDLE;
+	device->sample_valid = false;
 
 	/* Wait for sensor to initialize. */
-	HAL_Delay(AHT10_POWER_ON_DELAY);
+	AHT10_delay(AHT10_POWER_ON_DELAY);
 
 	/* Set sensor to normal measurement mode. */
-	AHT10_set_normal_mode();
+	AHT10_set_normal_mode(device);
 
 	/* Load factory calibration coefficients. */
-	return AHT10_enable_factory_cal_coeff();
+	return AHT10_enable_factory_cal_coeff(device);
 }
 
-bool AHT10_soft_reset(void) {
+bool AHT10_soft_reset(struct AHT10_HandleTypedef *device) {
 	uint8_t rx_buffer[1];
 	rx_buffer[0] = AHT10_SOFT_RESET_CMD;
 
 	/* Transmit soft reset command via I2C. */
-	result = HAL_I2C_Master_Transmit(_hi2c1, _address, rx_buffer, 1, AHT10_MY_I2C_DELAY);
+	HAL_StatusTypeDef result =
+			I2C_BUS_write(device->hi2c, device->address, rx_buffer, 1, AHT10_MY_I2C_DELAY);
 
 	if (result != HAL_OK) {
 		return false;
 	}
 
 	/* Wait for soft reset to complete. */
-	HAL_Delay(AHT10_SOFT_RESET_DELAY);
+	AHT10_delay(AHT10_SOFT_RESET_DELAY);
 
 	/* Reinitialize sensor registers after reset. */
-	AHT10_set_normal_mode();
-	return AHT10_enable_factory_cal_coeff();
+	AHT10_set_normal_mode(device);
+	return AHT10_enable_factory_cal_coeff(device);
 }
 
-bool AHT10_set_normal_mode(void) {
+bool AHT10_set_normal_mode(struct AHT10_HandleTypedef *device) {
 	uint8_t tx_buffer[3];
 
 	/* Prepare command buffer for normal mode. */
@@ -99,7 +103,8 @@ bool AHT10_set_normal_mode(void) {
 	tx_buffer[2] = AHT10_DATA_NOP;
 
 	/* Transmit normal mode command via I2C. */
-	result = HAL_I2C_Master_Transmit(_hi2c1, _address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
+	HAL_StatusTypeDef result =
+			I2C_BUS_write(device->hi2c, device->address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
 
 	/* Check if transmission is successful. */
 	if (result != HAL_OK) {
@@ -107,12 +112,12 @@ bool AHT10_set_normal_mode(void) {
 	}
 
 	/* Wait for command processing. */
-	HAL_Delay(AHT10_CMD_DELAY);
+	AHT10_delay(AHT10_CMD_DELAY);
 
 	return true;
 }
 
-bool AHT10_set_cycle_mode(void) {
+bool AHT10_set_cycle_mode(struct AHT10_HandleTypedef *device) {
 	uint8_t tx_buffer[3];
 
 	/* Prepare command buffer for cycle mode. */
@@ -121,7 +126,8 @@ bool AHT10_set_cycle_mode(void) {
 	tx_buffer[2] = AHT10_DATA_NOP;
 
 	/* Transmit cycle mode command via I2C. */
-	result = HAL_I2C_Master_Transmit(_hi2c1, _address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
+	HAL_StatusTypeDef result =
+			I2C_BUS_write(device->hi2c, device->address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
 
 	/* Check if transmission is successful. */
 	if (result != HAL_OK) {
@@ -131,7 +137,7 @@ bool AHT10_set_cycle_mode(void) {
 	return true;
 }
 
-bool AHT10_enable_factory_cal_coeff() {
+bool AHT10_enable_factory_cal_coeff(struct AHT10_HandleTypedef *device) {
 	uint8_t tx_buffer[3];
 
 	/* Prepare command buffer to enable calibration. */
@@ -140,7 +146,8 @@ bool AHT10_enable_factory_cal_coeff() {
 	tx_buffer[2] = AHT10_DATA_NOP;
 
 	/* Transmit calibration command via I2C. */
-	result = HAL_I2C_Master_Transmit(_hi2c1, _address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
+	HAL_StatusTypeDef result =
+			I2C_BUS_write(device->hi2c, device->address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
 
 	/* Check if transmission is successful. */
 	if (result != HAL_OK) {
@@ -148,111 +155,164 @@ bool AHT10_enable_factory_cal_coeff() {
 	}
 
 	/* Wait for command processing. */
-	HAL_Delay(AHT10_CMD_DELAY);
+	AHT10_delay(AHT10_CMD_DELAY);
 
 	/* Verify if calibration is enabled. */
-	if (AHT10_get_calibration_bit(AHT10_FORCE_READ_DATA) == 0x01) {
+	if (AHT10_get_calibration_bit(device, AHT10_FORCE_READ_DATA) == 0x01) {
 		return true;
 	} else {
 		return false;
 	}
 }
 
-uint8_t AHT10_read_raw_data() {
-	uint8_t tx_buffer[3];
-	tx_buffer[0] = AHT10_START_MEASURMENT_CMD;
-	tx_buffer[1] = AHT10_DATA_MEASURMENT_CMD;
-	tx_buffer[2] = AHT10_DATA_NOP;
-
-	/* Send measurement command via I2C. */
-	result = HAL_I2C_Master_Transmit(_hi2c1, _address, tx_buffer, 3, AHT10_MY_I2C_DELAY);
-
-	/* Error handling for I2C transmission failure. */
-	if (result != HAL_OK) {
-		return AHT10_ERROR;
+uint8_t AHT10_read_raw_data(struct AHT10_HandleTypedef *device) {
+	/* One measurement through the state machine, the task sleeps through the conversion. */
+	AHT10_measurement_begin(device);
+	while (AHT10_process(device) == AHT10_STATE_CONVERTING) {
+		uint32_t elapsed = HAL_GetTick() - device->tick;
+		AHT10_delay(elapsed < AHT10_MEASURMENT_DELAY ? AHT10_MEASURMENT_DELAY - elapsed : 1);
 	}
 
-	/* Error handling for calibration disabled. */
-	if (AHT10_get_calibration_bit(AHT10_FORCE_READ_DATA) != 0x01) {
+	/* Collect the 6 bytes of data read from the sensor. */
+	if (!AHT10_measurement_end(device)) {
 		return AHT10_ERROR;
 	}
 
-	/* Check if the sensor is busy and wait if necessary. */
-	if (AHT10_get_busy_bit(AHT10_USE_READ_DATA) != 0x00) {
-		HAL_Delay(AHT10_MEASURMENT_DELAY);
+	return true;
+}
+
+void AHT10_measurement_begin(struct AHT10_HandleTypedef *device) {
+	if ((device->state == AHT10_STATE_CONVERTING) || (device->state == AHT10_STATE_READING)) {
+		return;
 	}
+	device->xfer = (i2c_bus_xfer_t){
+			.address = device->address, .tx = measurement_cmd, .tx_len = sizeof(measurement_cmd)};
+	device->tick = HAL_GetTick();
+	device->state = AHT10_STATE_CONVERTING;
+	I2C_BUS_submit(&device->request, device->hi2c, &device->xfer, 1);
+
+	/* Nothing runs the request before the kernel is started */
+	if (osKernelGetState() != osKernelRunning) {
+		I2C_BUS_wait(&device->request, AHT10_MY_I2C_DELAY);
+	}
+}
 
-	/* Receive 6 bytes of data from the sensor. */
-	result = HAL_I2C_Master_Receive(_hi2c1, _address, raw_data_buffer, 6, AHT10_MY_I2C_DELAY);
+aht10_state_t AHT10_process(struct AHT10_HandleTypedef *device) {
+	uint32_t elapsed = HAL_GetTick() - device->tick;
 
-	if (result != HAL_OK) {
-		raw_data_buffer[0] = AHT10_ERROR;
-		return AHT10_ERROR;
+	if (device->state == AHT10_STATE_CONVERTING) {
+		/* The command is a few bytes on an idle bus, it has normally been sent long ago */
+		if (!device->request.done) {
+			if (elapsed < AHT10_MY_I2C_DELAY) {
+				return device->state;
+			}
+			I2C_BUS_wait(&device->request, 0);
+		}
+		if (device->request.status != HAL_OK) {
+			device->state = AHT10_STATE_ERROR;
+		} else if (elapsed >= AHT10_MEASURMENT_DELAY) {
+			/* Conversion over, queue the read of the status byte and the data */
+			device->xfer = (i2c_bus_xfer_t){
+					.address = device->address, .rx = device->raw_data, .rx_len = 6};
+			device->tick = HAL_GetTick();
+			device->state = AHT10_STATE_READING;
+			I2C_BUS_submit(&device->request, device->hi2c, &device->xfer, 1);
+		}
+	} else if (device->state == AHT10_STATE_READING) {
+		if (!device->request.done) {
+			if (elapsed < AHT10_MY_I2C_DELAY) {
+				return device->state;
+			}
+			I2C_BUS_wait(&device->request, 0);
+		}
+		/* The status byte comes first in the frame. */
+		if ((device->request.status != HAL_OK) ||
+				(AHT10_get_calibration_bit(device, AHT10_USE_READ_DATA) != 0x01) ||
+				(AHT10_get_busy_bit(device, AHT10_USE_READ_DATA) != 0x00)) {
+			device->raw_data[0] = AHT10_ERROR;
+			device->state = AHT10_STATE_ERROR;
+		} else {
+			/* Keep the sample, the frame buffer is overwritten by the next read */
+			device->temperature = AHT10_read_temperature(device, AHT10_USE_READ_DATA);
+			device->humidity = AHT10_read_humidity(device, AHT10_USE_READ_DATA);
+			device->sample_valid = true;
+			device->state = AHT10_STATE_READY;
+		}
 	}
+	return device->state;
+}
 
-	return true;
+bool AHT10_measurement_end(struct AHT10_HandleTypedef *device) {
+	if (AHT10_process(device) == AHT10_STATE_READING) {
+		/* The task sleeps for the bus time only, the conversion is already over */
+		I2C_BUS_wait(&device->request, AHT10_MY_I2C_DELAY);
+		AHT10_process(device);
+	}
+	return device->state == AHT10_STATE_READY;
 }
-uint8_t AHT10_read_status_byte() {
+
+uint8_t AHT10_read_status_byte(struct AHT10_HandleTypedef *device) {
 	/* Read a single byte status from the sensor via I2C. */
-	result = HAL_I2C_Master_Receive(_hi2c1, _address, raw_data_buffer, 1, AHT10_MY_I2C_DELAY);
+	HAL_StatusTypeDef result =
+			I2C_BUS_read(device->hi2c, device->address, device->raw_data, 1, AHT10_MY_I2C_DELAY);
 
 	/* Check if the I2C reception was successful. */
 	if (result != HAL_OK) {
-		raw_data_buffer[0] = AHT10_ERROR;
+		device->raw_data[0] = AHT10_ERROR;
 		return AHT10_ERROR;
 	}
 
-	return raw_data_buffer[0];
+	return device->raw_data[0];
 }
 
-uint8_t AHT10_get_calibration_bit(bool i2c_read) {
+uint8_t AHT10_get_calibration_bit(struct AHT10_HandleTypedef *device, bool i2c_read) {
 	uint8_t value_bit;
 
 	/* Force reading the status byte if required. */
 	if (i2c_read == AHT10_FORCE_READ_DATA) {
-		raw_data_buffer[0] = AHT10_read_status_byte();
+		device->raw_data[0] = AHT10_read_status_byte(device);
 	}
 
 	/* Extract the 3rd bit (calibration bit) from the status byte. */
-	if (raw_data_buffer[0] != AHT10_ERROR) {
-		value_bit = (raw_data_buffer[0] & CALIBRATION_BIT_MASK);
+	if (device->raw_data[0] != AHT10_ERROR) {
+		value_bit = (device->raw_data[0] & CALIBRATION_BIT_MASK);
 		return (value_bit >> CALIBRATION_BIT_SHIFT);
 	} else {
 		return AHT10_ERROR;
 	}
 }
 
-uint8_t AHT10_get_busy_bit(bool i2c_read) {
+uint8_t AHT10_get_busy_bit(struct AHT10_HandleTypedef *device, bool i2c_read) {
 	uint8_t value_bit;
 
 	/* Force reading the status byte if required. */
 	if (i2c_read == AHT10_FORCE_READ_DATA) {
-		raw_data_buffer[0] = AHT10_read_status_byte();
+		device->raw_data[0] = AHT10_read_status_byte(device);
 	}
 
 	/* Extract the 7th bit (busy bit) from the status byte. */
-	if (raw_data_buffer[0] != AHT10_ERROR) {
-		value_bit = (raw_data_buffer[0] & AHT10_BUSY_BIT_MASK);
+	if (device->raw_data[0] != AHT10_ERROR) {
+		value_bit = (device->raw_data[0] & AHT10_BUSY_BIT_MASK);
 		return (value_bit >> BUSY_BIT_SHIFT);
 	} else {
 		return AHT10_ERROR;
 	}
 }
 
-float AHT10_read_temperature(bool i2c_read) {
+float AHT10_read_temperature(struct AHT10_HandleTypedef *device, bool i2c_read) {
 	unsigned temperature;
 
 	/* Check if a forced read of data is requested */
 	if (i2c_read == AHT10_FORCE_READ_DATA) {
 		/* Read raw data from sensor and check for errors */
-		if (AHT10_read_raw_data() == AHT10_ERROR) {
+		if (AHT10_read_raw_data(device) == AHT10_ERROR) {
 			/* Return error code if reading raw data fails */
 			return AHT10_ERROR;
 		}
 	}
 
 	/* Check if there was an error during the I2C communication */
-	if (raw_data_buffer[0] == AHT10_ERROR) {
+	if (device->raw_data[0] == AHT10_ERROR) {
 		/* Return error code if there was a collision or error on the I2C bus */
 		return AHT10_ERROR;
 	}
@@ -262,30 +322,30 @@ float AHT10_read_temperature(bool i2c_read) {
 	 * It has a chance of not being used at all in case of an return AHT10_ERROR
 	 */
 
-	/* Extract 20-bit raw temperature data from the raw_data_buffer */
+	/* Extract 20-bit raw temperature data from the device->raw_data */
 	/* Combine bytes 3, 4, and 5 to form a 20-bit integer */
-	temperature = ((uint32_t)(raw_data_buffer[3] & TEMPERATURE_LOWER_4_BITS_MASK)
+	temperature = ((uint32_t)(device->raw_data[3] & TEMPERATURE_LOWER_4_BITS_MASK)
 						  << AHT10_RAW_TEMP_SHIFT_16) |
-				  ((uint16_t)raw_data_buffer[4] << AHT10_RAW_TEMP_SHIFT_8) | raw_data_buffer[5];
+				  ((uint16_t)device->raw_data[4] << AHT10_RAW_TEMP_SHIFT_8) | device->raw_data[5];
 
 	/* Convert raw temperature data to Celsius and return it */
 	return (float)temperature * AHT10_TEMP_CONVERT_SCALE + AHT10_TEMP_CONVERT_OFFSET;
 }
 
-float AHT10_read_humidity(bool i2c_read) {
+float AHT10_read_humidity(struct AHT10_HandleTypedef *device, bool i2c_read) {
 	unsigned raw_data;
 
 	/* Check if a forced read of data is requested */
 	if (i2c_read == AHT10_FORCE_READ_DATA) {
 		/* Read raw data from sensor and check for errors */
-		if (AHT10_read_raw_data() == AHT10_ERROR) {
+		if (AHT10_read_raw_data(device) == AHT10_ERROR) {
 			/* Return error code if reading raw data fails */
 			return AHT10_ERROR;
 		}
 	}
 
 	/* Check if there was an error during the I2C communication */
-	if (raw_data_buffer[0] == AHT10_ERROR) {
+	if (device->raw_data[0] == AHT10_ERROR) {
 		/* Return error code if there was a collision or error on the I2C bus */
 		return AHT10_ERROR;
 	}
@@ -295,11 +355,11 @@ float AHT10_read_humidity(bool i2c_read) {
 	 * It has a chance of not being used at all in case of an return AHT10_ERROR
 	 */
 
-	/* Extract 20-bit raw humidity data from the raw_data_buffer */
+	/* Extract 20-bit raw humidity data from the device->raw_data */
 	/* Combine bytes 1, 2, and 3, then shift right by 4 bits to obtain 20-bit value */
-	raw_data = (((unsigned)raw_data_buffer[1] << AHT10_RAW_HUMIDITY_SHIFT_16) |
-					   ((uint16_t)raw_data_buffer[2] << AHT10_RAW_HUMIDITY_SHIFT_8) |
-					   (raw_data_buffer[3])) >>
+	raw_data = (((unsigned)device->raw_data[1] << AHT10_RAW_HUMIDITY_SHIFT_16) |
+					   ((uint16_t)device->raw_data[2] << AHT10_RAW_HUMIDITY_SHIFT_8) |
+					   (device->raw_data[3])) >>
 			   AHT10_RAW_HUMIDITY_SHIFT_4;
 
 	/* Convert raw humidity data to percentage and clamp the value to [0, 100] range */
@@ -54,8 +54,8 @@
 #define BMP280_TEMP_ADJUSTMENT 128
 
 /* Constants for BMP280 data reading */
-#define BMP280_PRESSURE_DATA_SIZE    6    /* Number of bytes to read for pressure */
-#define BMP280_TEMPERATURE_DATA_SIZE 4    /* Number of bytes to read for temperature */
+#define BMP280_PRESSURE_DATA_SIZE    6    /* Number of bytes of a pressure and temperature sample */
+#define BMP280_CALIB_DATA_SIZE       24   /* Number of bytes of the calibration block */
 #define BMP280_DATA_START_ADDR       0xF7 /* Starting register address for data read */
 
 /* Bit shift constants for ADC data extraction */
@@ -82,27 +82,12 @@
 #define BMP280_CTRL_MODE_MASK 0x03 /**< Mask for mode bits */
 
 /**
- * @brief Function for reading data (2 bytes) from a register.
- * @details Reads a 2-byte value from the specified register address of the BMP280 sensor.
- * @param[in] device Pointer to BMP Handle structure.
- * @param address Memory address to read from.
- * @param[in] value Pointer to store the read result.
- * @return True on success, false otherwise.
+ * @brief Function for combining a 16-bit value stored low byte first.
+ * @param[in] data Pointer to the low byte, the high byte follows it.
+ * @return The value.
  */
-static bool read_register(struct BMP280_HandleTypedef *device, uint8_t address, uint16_t *value) {
-	uint16_t tx_buff;
-	uint8_t rx_buff[2];
-	/* Shift address for I2C write operation. */
-	tx_buff = (device->address << 1);
-
-	/* Read 2 bytes from the specified register. */
-	if (HAL_I2C_Mem_Read(device->hi2c1, tx_buff, address, 1, rx_buff, 2, 5000) == HAL_OK) {
-		/* Combine bytes. */
-		*value = (uint16_t)((rx_buff[1] << 8) | rx_buff[0]);
-		return true;
-	} else {
-		return false;
-	}
+static inline uint16_t get_le16(const uint8_t *data) {
+	return (uint16_t)((data[1] << 8) | data[0]);
 }
 
 /**
@@ -120,7 +105,7 @@ static inline int read_data(struct BMP280_HandleTypedef *device, uint8_t address
 	uint16_t tx_buff = (device->address << 1);
 
 	/* Read data from the specified register. */
-	if (HAL_I2C_Mem_Read(device->hi2c1, tx_buff, address, 1, value, len, 5000) == HAL_OK) {
+	if (I2C_BUS_read_reg(device->hi2c1, tx_buff, address, value, len, 5000) == HAL_OK) {
 		return 0;
 	} else {
 		return 1;
@@ -134,23 +119,27 @@ static inline int read_data(struct BMP280_HandleTypedef *device, uint8_t address
  * @return True on success, false otherwise.
  */
 static bool read_calibration_data(struct BMP280_HandleTypedef *device) {
-	/* Read each calibration register using defined addresses. */
-	if (read_register(device, BMP280_REG_CALIB_DIG_T1, &device->dig_T1) &&
-			read_register(device, BMP280_REG_CALIB_DIG_T2, (uint16_t *)&device->dig_T2) &&
-			read_register(device, BMP280_REG_CALIB_DIG_T3, (uint16_t *)&device->dig_T3) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P1, &device->dig_P1) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P2, (uint16_t *)&device->dig_P2) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P3, (uint16_t *)&device->dig_P3) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P4, (uint16_t *)&device->dig_P4) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P5, (uint16_t *)&device->dig_P5) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P6, (uint16_t *)&device->dig_P6) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P7, (uint16_t *)&device->dig_P7) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P8, (uint16_t *)&device->dig_P8) &&
-			read_register(device, BMP280_REG_CALIB_DIG_P9, (uint16_t *)&device->dig_P9)) {
-		return true;
-	} else {
+	uint8_t calib[BMP280_CALIB_DATA_SIZE];
+
+	/* Read the whole calibration block in one burst. */
+	if (read_data(device, BMP280_REG_CALIB, calib, sizeof(calib))) {
 		return false;
 	}
+
+	/* Store each coefficient from its offset in the block. */
+	device->dig_T1 = get_le16(&calib[BMP280_REG_CALIB_DIG_T1 - BMP280_REG_CALIB]);
+	device->dig_T2 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_T2 - BMP280_REG_CALIB]);
+	device->dig_T3 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_T3 - BMP280_REG_CALIB]);
+	device->dig_P1 = get_le16(&calib[BMP280_REG_CALIB_DIG_P1 - BMP280_REG_CALIB]);
+	device->dig_P2 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P2 - BMP280_REG_CALIB]);
+	device->dig_P3 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P3 - BMP280_REG_CALIB]);
+	device->dig_P4 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P4 - BMP280_REG_CALIB]);
+	device->dig_P5 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P5 - BMP280_REG_CALIB]);
+	device->dig_P6 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P6 - BMP280_REG_CALIB]);
+	device->dig_P7 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P7 - BMP280_REG_CALIB]);
+	device->dig_P8 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P8 - BMP280_REG_CALIB]);
+	device->dig_P9 = (int16_t)get_le16(&calib[BMP280_REG_CALIB_DIG_P9 - BMP280_REG_CALIB]);
+	return true;
 }
 
 /**
@@ -166,7 +155,7 @@ static bool write_register8(struct BMP280_HandleTypedef *device, uint8_t address
 	uint16_t tx_buff = (device->address << 1);
 
 	/* Write the data to the specified register. */
-	if (HAL_I2C_Mem_Write(device->hi2c1, tx_buff, address, 1, &value, 1, 10000) == HAL_OK) {
+	if (I2C_BUS_write_reg(device->hi2c1, tx_buff, address, &value, 1, 10000) == HAL_OK) {
 		return true;
 	} else {
 		return false;
@@ -350,33 +339,66 @@ bool BMP280_is_measuring(struct BMP280_HandleTypedef *device) {
 
 bool BMP280_read_fixed(struct BMP280_HandleTypedef *device, int32_t *temperature,
 		uint32_t *pressure) {
-	uint8_t data[8];
-
-	/* Determine read size based on requested data. */
-	size_t size = pressure ? BMP280_PRESSURE_DATA_SIZE : BMP280_TEMPERATURE_DATA_SIZE;
+	int32_t fixed_temperature;
+	uint32_t fixed_pressure;
 
-	/* Return false if reading data fails. */
-	if (read_data(device, BMP280_DATA_START_ADDR, data, size)) {
+	/* Both values come from one burst, the pressure compensation needs the temperature anyway. */
+	BMP280_read_begin(device);
+	if (!BMP280_read_end(device, &fixed_temperature, &fixed_pressure)) {
 		return false;
 	}
 
-	int32_t fine_temp = 0;
-
-	/* Compensate pressure if requested. */
+	if (temperature) {
+		*temperature = fixed_temperature;
+	}
 	if (pressure) {
-		int32_t adc_pressure = data[0] << BMP280_PRESSURE_SHIFT_12 |
-							   data[1] << BMP280_PRESSURE_SHIFT_4 | data[2] >> BMP280_ADC_SHIFT;
-		*pressure = compensate_pressure(device, adc_pressure, fine_temp);
+		*pressure = fixed_pressure;
 	}
+	return true;
+}
 
-	/* Compensate temperature if requested. */
-	if (temperature) {
-		int32_t adc_temp = data[3] << BMP280_TEMP_SHIFT_12 | data[4] << BMP280_TEMP_SHIFT_4 |
-						   data[5] >> BMP280_ADC_SHIFT;
-		*temperature = compensate_temperature(device, adc_temp, &fine_temp);
+bool BMP280_read_sample(struct BMP280_HandleTypedef *device, float *temperature, float *pressure) {
+	int32_t fixed_temperature;
+	uint32_t fixed_pressure;
+
+	/* Convert both values of a single burst to float. */
+	if (!BMP280_read_fixed(device, &fixed_temperature, &fixed_pressure)) {
+		return false;
 	}
+	*temperature = (float)fixed_temperature / 100;
+	*pressure = (float)fixed_pressure / 256;
+	return true;
+}
+
+void BMP280_read_begin(struct BMP280_HandleTypedef *device) {
+	/* The request reads from the handle, which outlives it. */
+	device->reg = BMP280_DATA_START_ADDR;
+	device->xfer = (i2c_bus_xfer_t){.address = device->address << 1,
+			.tx = &device->reg,
+			.tx_len = 1,
+			.rx = device->data,
+			.rx_len = BMP280_PRESSURE_DATA_SIZE};
+	I2C_BUS_submit(&device->request, device->hi2c1, &device->xfer, 1);
+}
+
+bool BMP280_read_end(struct BMP280_HandleTypedef *device, int32_t *temperature,
+		uint32_t *pressure) {
+	const uint8_t *data = device->data;
+	int32_t fine_temp;
+
+	/* Return false if reading data fails. */
+	if (I2C_BUS_wait(&device->request, 5000) != HAL_OK) {
+		return false;
+	}
+
+	/* Temperature comes first, the pressure compensation depends on fine_temp. */
+	int32_t adc_temp = data[3] << BMP280_TEMP_SHIFT_12 | data[4] << BMP280_TEMP_SHIFT_4 |
+					   data[5] >> BMP280_ADC_SHIFT;
+	*temperature = compensate_temperature(device, adc_temp, &fine_temp);
 
-	/* Return true if data read and compensation are successful. */
+	int32_t adc_pressure = data[0] << BMP280_PRESSURE_SHIFT_12 |
+						   data[1] << BMP280_PRESSURE_SHIFT_4 | data[2] >> BMP280_ADC_SHIFT;
+	*pressure = compensate_pressure(device, adc_pressure, fine_temp);
 	return true;
 }
 
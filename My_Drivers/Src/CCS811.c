@@ -3,6 +3,7 @@
  */
 
 #include "CCS811.h"
+#include "I2C_BUS.h"
 
 /* Define constants for bit manipulation */
 #define FIRMWARE_ERROR_BIT_MASK 0x01 /* Mask for checking the firmware error bit */
@@ -33,14 +34,14 @@ uint8_t CCS811_init(I2C_HandleTypeDef *hi2c) {
 	}
 
 	/* Read the status register to check for errors */
-	HAL_I2C_Mem_Read(hi2c, CCS811_ADDRESS, CCS811_STATUS, 1, &check_firmware, 1, TIMEOUT);
+	I2C_BUS_read_reg(hi2c, CCS811_ADDRESS, CCS811_STATUS, &check_firmware, 1, TIMEOUT);
 	/* Check if there are no errors indicated by the status register */
 	if ((check_firmware & FIRMWARE_ERROR_BIT_MASK) == HAL_OK) {
 		/* Send application start command to the sensor */
-		HAL_I2C_Master_Transmit(hi2c, CCS811_ADDRESS, &app_start, 1, TIMEOUT);
+		I2C_BUS_write(hi2c, CCS811_ADDRESS, &app_start, 1, TIMEOUT);
 		uint8_t meas_mode = CCS811_MEAS_MODE_1;
 		/* Set the measurement mode of the sensor */
-		HAL_I2C_Mem_Write(hi2c, CCS811_ADDRESS, CCS811_MEAS_MODE_REG, 1, &meas_mode, 1, TIMEOUT);
+		I2C_BUS_write_reg(hi2c, CCS811_ADDRESS, CCS811_MEAS_MODE_REG, &meas_mode, 1, TIMEOUT);
 		return HAL_OK; /* Return success if initialization is complete */
 	} else {
 		return HAL_ERROR; /* Return error if initialization failed */
@@ -53,12 +54,12 @@ uint8_t CCS811_alg_read_data(I2C_HandleTypeDef *hi2c, uint16_t *co2, uint16_t *t
 	uint8_t meas_mode;
 
 	/* Read the status register to check if data is ready */
-	HAL_I2C_Mem_Read(hi2c, CCS811_ADDRESS, CCS811_STATUS, 1, &status_register, 1, TIMEOUT);
-	HAL_I2C_Mem_Read(hi2c, CCS811_ADDRESS, 0x01, 1, &meas_mode, 1, TIMEOUT);
+	I2C_BUS_read_reg(hi2c, CCS811_ADDRESS, CCS811_STATUS, &status_register, 1, TIMEOUT);
+	I2C_BUS_read_reg(hi2c, CCS811_ADDRESS, 0x01, &meas_mode, 1, TIMEOUT);
 	/* Check if data is available */
 	if ((status_register >> STATUS_BIT_3 & BIT_CHECK_MASK) == 1) {
 		/* Read data from the sensor */
-		HAL_I2C_Mem_Read(hi2c, CCS811_ADDRESS, CCS811_ALG_RESULT_DATA, 1, received_data,
+		I2C_BUS_read_reg(hi2c, CCS811_ADDRESS, CCS811_ALG_RESULT_DATA, received_data,
 				sizeof(received_data), TIMEOUT);
 		/* Extract CO2 value by combining the two bytes with appropriate shifts */
 		*co2 = (uint16_t)((received_data[0] << DATA_BYTE_0_SHIFT) | (received_data[1]));
@@ -68,3 +69,37 @@ uint8_t CCS811_alg_read_data(I2C_HandleTypeDef *hi2c, uint16_t *co2, uint16_t *t
 	}
 	return HAL_ERROR; /* Return error if data is not available */
 }
+
+void CCS811_read_begin(struct CCS811_HandleTypedef *device) {
+	/* The request reads from the handle, which outlives it */
+	device->status_reg = CCS811_STATUS;
+	device->result_reg = CCS811_ALG_RESULT_DATA;
+	device->xfers[0] = (i2c_bus_xfer_t){.address = CCS811_ADDRESS,
+			.tx = &device->status_reg,
+			.tx_len = 1,
+			.rx = &device->status,
+			.rx_len = 1};
+	device->xfers[1] = (i2c_bus_xfer_t){.address = CCS811_ADDRESS,
+			.tx = &device->result_reg,
+			.tx_len = 1,
+			.rx = device->result,
+			.rx_len = sizeof(device->result)};
+	I2C_BUS_submit(&device->request, device->hi2c, device->xfers, 2);
+}
+
+uint8_t CCS811_read_end(struct CCS811_HandleTypedef *device, uint16_t *co2, uint16_t *tvoc) {
+	const uint8_t *result = device->result;
+
+	if (I2C_BUS_wait(&device->request, 2 * TIMEOUT) != HAL_OK) {
+		return HAL_ERROR;
+	}
+	/* The result registers were read anyway, they only hold new data when the status says so */
+	if ((device->status >> STATUS_BIT_3 & BIT_CHECK_MASK) != 1) {
+		return HAL_ERROR;
+	}
+	/* Extract CO2 value by combining the two bytes with appropriate shifts */
+	*co2 = (uint16_t)((result[0] << DATA_BYTE_0_SHIFT) | (result[1]));
+	/* Extract TVOC value by combining the two bytes with appropriate shifts */
+	*tvoc = (uint16_t)((result[2] << DATA_BYTE_2_SHIFT) | (result[3]));
+	return HAL_OK;
+}
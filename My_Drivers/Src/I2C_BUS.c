@@ -0,0 +1,331 @@
+/**
+ * I2C transaction engine realisation
+ */
+
+#include "I2C_BUS.h"
+#include <string.h>
+
+/* Queue of one bus, the head is the request being run */
+typedef struct {
+	I2C_HandleTypeDef *hi2c;
+	i2c_bus_request_t *head;
+	/* Set while the peripheral is reinitialized after a timeout, nothing is started meanwhile */
+	bool resetting;
+} i2c_bus_t;
+
+static i2c_bus_t buses[I2C_BUS_COUNT];
+
+/**
+ * @brief Masks the interrupts, the queues are shared with the completion interrupts.
+ * @return The previous mask, for I2C_BUS_unlock().
+ */
+static uint32_t I2C_BUS_lock(void) {
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	return primask;
+}
+
+/**
+ * @brief Restores the interrupt mask saved by I2C_BUS_lock().
+ * @param primask The saved mask.
+ */
+static void I2C_BUS_unlock(uint32_t primask) {
+	__set_PRIMASK(primask);
+}
+
+/**
+ * @brief Finds the queue of a bus.
+ * @param hi2c The bus.
+ * @param claim True to take a free slot for a bus seen for the first time.
+ * @return The queue, NULL when the bus is unknown or all slots are taken.
+ */
+static i2c_bus_t *I2C_BUS_find(I2C_HandleTypeDef *hi2c, bool claim) {
+	for (uint8_t i = 0; i < I2C_BUS_COUNT; i++) {
+		if (buses[i].hi2c == hi2c)
+			return &buses[i];
+	}
+	if (!claim)
+		return NULL;
+	for (uint8_t i = 0; i < I2C_BUS_COUNT; i++) {
+		if (buses[i].hi2c == NULL) {
+			buses[i].hi2c = hi2c;
+			return &buses[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Tells whether a transfer is a register read and its register address is valid.
+ * @param xfer The transfer.
+ * @return 1 for a valid register read, 0 for a plain transfer, -1 for an invalid address.
+ */
+static int8_t I2C_BUS_is_mem(const i2c_bus_xfer_t *xfer) {
+	if ((xfer->tx == NULL) || (xfer->rx == NULL))
+		return 0;
+	return ((xfer->tx_len == 1) || (xfer->tx_len == 2)) ? 1 : -1;
+}
+
+/**
+ * @brief Returns the register address of a register read.
+ * @param xfer The transfer.
+ */
+static uint16_t I2C_BUS_reg(const i2c_bus_xfer_t *xfer) {
+	return (xfer->tx_len == 1) ? xfer->tx[0] : (xfer->tx[0] << 8) | xfer->tx[1];
+}
+
+/**
+ * @brief Returns the HAL size of the register address of a register read.
+ * @param xfer The transfer.
+ */
+static uint16_t I2C_BUS_reg_size(const i2c_bus_xfer_t *xfer) {
+	return (xfer->tx_len == 1) ? I2C_MEMADD_SIZE_8BIT : I2C_MEMADD_SIZE_16BIT;
+}
+
+/**
+ * @brief Starts the current transfer of a request with the interrupt driven HAL functions.
+ * @param req The request.
+ * @return The status of the HAL function, HAL_ERROR for an invalid transfer.
+ */
+static HAL_StatusTypeDef I2C_BUS_start(i2c_bus_request_t *req) {
+	const i2c_bus_xfer_t *xfer = &req->xfers[req->index];
+	int8_t mem = I2C_BUS_is_mem(xfer);
+
+	if (mem < 0)
+		return HAL_ERROR;
+	if (mem > 0)
+		return HAL_I2C_Mem_Read_IT(req->hi2c, xfer->address, I2C_BUS_reg(xfer),
+				I2C_BUS_reg_size(xfer), xfer->rx, xfer->rx_len);
+	if (xfer->rx != NULL)
+		return HAL_I2C_Master_Receive_IT(req->hi2c, xfer->address, xfer->rx, xfer->rx_len);
+	return HAL_I2C_Master_Transmit_IT(req->hi2c, xfer->address, (uint8_t *)xfer->tx,
+			xfer->tx_len);
+}
+
+/**
+ * @brief Runs a request with the blocking HAL functions, before the kernel is started.
+ * @param req The request.
+ * @param timeout Timeout of every transfer in milliseconds.
+ */
+static void I2C_BUS_run_blocking(i2c_bus_request_t *req, uint32_t timeout) {
+	HAL_StatusTypeDef status = HAL_OK;
+
+	for (; (req->index < req->count) && (status == HAL_OK); req->index++) {
+		const i2c_bus_xfer_t *xfer = &req->xfers[req->index];
+		int8_t mem = I2C_BUS_is_mem(xfer);
+		if (mem < 0) {
+			status = HAL_ERROR;
+		} else if (mem > 0) {
+			status = HAL_I2C_Mem_Read(req->hi2c, xfer->address, I2C_BUS_reg(xfer),
+					I2C_BUS_reg_size(xfer), xfer->rx, xfer->rx_len, timeout);
+		} else if (xfer->rx != NULL) {
+			status = HAL_I2C_Master_Receive(req->hi2c, xfer->address, xfer->rx, xfer->rx_len,
+					timeout);
+		} else {
+			status = HAL_I2C_Master_Transmit(req->hi2c, xfer->address, (uint8_t *)xfer->tx,
+					xfer->tx_len, timeout);
+		}
+	}
+	req->status = status;
+	req->done = true;
+}
+
+/**
+ * @brief Takes the head request out of the queue and wakes its task.
+ * @param bus The queue.
+ */
+static void I2C_BUS_complete(i2c_bus_t *bus) {
+	i2c_bus_request_t *req = bus->head;
+	bus->head = req->next;
+	req->next = NULL;
+	req->done = true;
+	osThreadFlagsSet(req->task, I2C_BUS_FLAG);
+}
+
+/**
+ * @brief Moves the queue on: starts the next transfer or completes the finished requests.
+ * @details Called with the interrupts masked or from the completion interrupts. A transfer the
+ * HAL refuses as busy stays at the head, its waiter times out and reinitializes the bus.
+ * @param bus The queue.
+ */
+static void I2C_BUS_kick(i2c_bus_t *bus) {
+	i2c_bus_request_t *req;
+
+	if (bus->resetting)
+		return;
+	while ((req = bus->head) != NULL) {
+		if (req->index < req->count) {
+			HAL_StatusTypeDef status = I2C_BUS_start(req);
+			if ((status == HAL_OK) || (status == HAL_BUSY))
+				return;
+			req->status = HAL_ERROR;
+		}
+		I2C_BUS_complete(bus);
+	}
+}
+
+/**
+ * @brief Ends the running transfer of a bus, called from the HAL callbacks.
+ * @param hi2c The bus.
+ * @param status HAL_OK when the transfer succeeded.
+ */
+static void I2C_BUS_done(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef status) {
+	i2c_bus_t *bus = I2C_BUS_find(hi2c, false);
+	if ((bus == NULL) || (bus->head == NULL) || bus->resetting)
+		return;
+
+	i2c_bus_request_t *req = bus->head;
+	if (status == HAL_OK) {
+		req->index++;
+	} else {
+		/* The rest of the chain depends on this transfer */
+		req->status = status;
+		req->index = req->count;
+	}
+	I2C_BUS_kick(bus);
+}
+
+/**
+ * @brief Takes a request which did not complete in time out of its queue.
+ * @details The bus is reinitialized when the request was being run, so the transfer still going
+ * on can not complete into the next request, which is started afterwards.
+ * @param req The request.
+ */
+static void I2C_BUS_abort(i2c_bus_request_t *req) {
+	uint32_t primask = I2C_BUS_lock();
+	i2c_bus_t *bus = I2C_BUS_find(req->hi2c, false);
+	if (req->done || (bus == NULL)) {
+		I2C_BUS_unlock(primask);
+		return;
+	}
+
+	bool running = (bus->head == req);
+	i2c_bus_request_t **link = &bus->head;
+	while ((*link != NULL) && (*link != req))
+		link = &(*link)->next;
+	if (*link != NULL)
+		*link = req->next;
+	req->next = NULL;
+	req->status = HAL_TIMEOUT;
+	req->done = true;
+	if (running)
+		bus->resetting = true;
+	I2C_BUS_unlock(primask);
+
+	if (!running)
+		return;
+	HAL_I2C_DeInit(bus->hi2c);
+	HAL_I2C_Init(bus->hi2c);
+
+	primask = I2C_BUS_lock();
+	bus->resetting = false;
+	I2C_BUS_kick(bus);
+	I2C_BUS_unlock(primask);
+}
+
+void I2C_BUS_submit(i2c_bus_request_t *req, I2C_HandleTypeDef *hi2c, const i2c_bus_xfer_t *xfers,
+		uint8_t count) {
+	req->hi2c = hi2c;
+	req->xfers = xfers;
+	req->count = count;
+	req->index = 0;
+	req->done = false;
+	req->status = HAL_OK;
+	req->next = NULL;
+	req->task = NULL;
+
+	/* Run by I2C_BUS_wait(), nobody could be woken */
+	if (osKernelGetState() != osKernelRunning)
+		return;
+
+	req->task = osThreadGetId();
+	/* A completion left over from an aborted request must not end the wait early */
+	osThreadFlagsClear(I2C_BUS_FLAG);
+
+	uint32_t primask = I2C_BUS_lock();
+	i2c_bus_t *bus = I2C_BUS_find(hi2c, true);
+	if (bus == NULL) {
+		req->status = HAL_ERROR;
+		req->done = true;
+		I2C_BUS_unlock(primask);
+		return;
+	}
+	i2c_bus_request_t **link = &bus->head;
+	while (*link != NULL)
+		link = &(*link)->next;
+	*link = req;
+	if (bus->head == req)
+		I2C_BUS_kick(bus);
+	I2C_BUS_unlock(primask);
+}
+
+HAL_StatusTypeDef I2C_BUS_wait(i2c_bus_request_t *req, uint32_t timeout) {
+	if (req->task == NULL) {
+		if (!req->done)
+			I2C_BUS_run_blocking(req, timeout);
+		return req->status;
+	}
+
+	uint32_t start = osKernelGetTickCount();
+	while (!req->done) {
+		uint32_t elapsed = osKernelGetTickCount() - start;
+		if (elapsed >= timeout) {
+			I2C_BUS_abort(req);
+			break;
+		}
+		osThreadFlagsWait(I2C_BUS_FLAG, osFlagsWaitAny, timeout - elapsed);
+	}
+	return req->status;
+}
+
+HAL_StatusTypeDef I2C_BUS_transfer(I2C_HandleTypeDef *hi2c, const i2c_bus_xfer_t *xfers,
+		uint8_t count, uint32_t timeout) {
+	i2c_bus_request_t req;
+	I2C_BUS_submit(&req, hi2c, xfers, count);
+	return I2C_BUS_wait(&req, timeout);
+}
+
+HAL_StatusTypeDef I2C_BUS_write(I2C_HandleTypeDef *hi2c, uint16_t address, const uint8_t *data,
+		uint16_t len, uint32_t timeout) {
+	i2c_bus_xfer_t xfer = {.address = address, .tx = data, .tx_len = len};
+	return I2C_BUS_transfer(hi2c, &xfer, 1, timeout);
+}
+
+HAL_StatusTypeDef I2C_BUS_read(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data,
+		uint16_t len, uint32_t timeout) {
+	i2c_bus_xfer_t xfer = {.address = address, .rx = data, .rx_len = len};
+	return I2C_BUS_transfer(hi2c, &xfer, 1, timeout);
+}
+
+HAL_StatusTypeDef I2C_BUS_read_reg(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t reg,
+		uint8_t *data, uint16_t len, uint32_t timeout) {
+	i2c_bus_xfer_t xfer = {.address = address, .tx = &reg, .tx_len = 1, .rx = data, .rx_len = len};
+	return I2C_BUS_transfer(hi2c, &xfer, 1, timeout);
+}
+
+HAL_StatusTypeDef I2C_BUS_write_reg(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t reg,
+		const uint8_t *data, uint16_t len, uint32_t timeout) {
+	uint8_t buf[I2C_BUS_WRITE_MAX + 1];
+	if (len > I2C_BUS_WRITE_MAX)
+		return HAL_ERROR;
+	buf[0] = reg;
+	memcpy(&buf[1], data, len);
+	return I2C_BUS_write(hi2c, address, buf, len + 1, timeout);
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+	I2C_BUS_done(hi2c, HAL_OK);
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+	I2C_BUS_done(hi2c, HAL_OK);
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+	I2C_BUS_done(hi2c, HAL_OK);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+	/* A NACK or a bus error, the HAL has already released the bus */
+	I2C_BUS_done(hi2c, HAL_ERROR);
+}
@@ -4,10 +4,15 @@
 
 #include "ST7735.h"
 #include "ST7735_FONT.h"
+#if ST7735_USE_MIRROR
+#include "ST7735_MIRROR.h"
+#endif
 #include "cmsis_os.h"
 #include <stm32f4xx_hal.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 extern osMutexId_t ScreenMutexHandle;
 /**
@@ -112,20 +117,250 @@ static uint16_t textbgcolor = ST77XX_BLACK;
 /* Indicates whether text should wrap at the end of a line. */
 static uint8_t wrap = 1;
 
+/**
+ * @brief Glyph expanded for drawing.
+ * @param font, c Font and character of the glyph, font is NULL for an unused entry
+ * @param width Advance width in pixels
+ * @param stamp Time of the last use, the entry with the oldest one is replaced
+ * @param rows One bit mask per row, bit 31 is the leftmost pixel
+ */
+typedef struct {
+	const st7735_font_t *font;
+	uint8_t c;
+	uint8_t width;
+	uint32_t stamp;
+	uint32_t rows[ST7735_GLYPH_MAX_SIZE];
+} st7735_glyph_cache_t;
+
+/* Recently drawn proportional glyphs. */
+static st7735_glyph_cache_t glyph_cache[ST7735_GLYPH_CACHE];
+
+/* Use counter of glyph_cache, the source of the entry stamps. */
+static uint32_t glyph_cache_clock;
+
+/* Frame memory lines of the scrolling band, see ST7735_scroll_area(). */
+static uint16_t scroll_first, scroll_lines;
+
+/* Frame memory line shown at the start of the scrolling band, the last VSCRSADD argument. */
+static uint16_t scroll_address;
+
+/* True while the controller is in sleep mode, see ST7735_sleep(). */
+static bool sleeping;
+
+/* SPI traffic counters, see ST7735_get_stats(). */
+static st7735_stats_t stats;
+
+/* Task holding the screen lock taken with ST7735_lock(), NULL when the lock is free. */
+static osThreadId_t volatile lock_owner;
+
+/* Nesting depth of the screen lock held by lock_owner. */
+static uint8_t lock_depth;
+
+/* Nesting depth of ST7735_start_write(), CS is only toggled at the outermost level. */
+static uint8_t write_depth;
+
+/* Address window last sent with CASET/RASET, in panel coordinates, valid once win_valid is set. */
+static uint16_t win_x0, win_x1, win_y0, win_y1;
+static bool win_valid;
+
+/* Set while a RAMWR stream is open, i.e. no other command and no CS release since RAMWR. */
+static bool ram_open;
+
+/* Pixel data bytes written since the last RAMWR, gives the position of the write cursor. */
+static uint32_t ram_bytes;
+
+/* Set while the SPI sends 16-bit frames, i.e. RGB565 pixels; commands use 8-bit frames. */
+static bool spi_16bit;
+
+/* Longest transfer accepted by the HAL SPI functions, in frames. */
+#define ST7735_SPI_MAX_CHUNK 0xFFFFU
+
+/* Size of a line buffer in pixels, one line along the longest side of the display. */
+#define ST7735_LINE_BUF_SIZE ST7735_TFTHEIGHT_160
+
+/* Ping-pong line buffers: one is filled by the CPU while the other one is on the bus. */
+static uint16_t line_buf[2][ST7735_LINE_BUF_SIZE];
+
+/* Index of the line buffer handed out next. */
+static uint8_t line_buf_idx;
+
+#if !ST7735_USE_FRAMEBUFFER && !ST7735_USE_DMA
+/* Size of the solid fill chunk buffer in pixels. */
+#define ST7735_FILL_BUF_SIZE 256
+
+/* Chunk buffer preset with one color, sent repeatedly to fill an address window. */
+static uint16_t fill_buf[ST7735_FILL_BUF_SIZE];
+
+/* Color currently stored in fill_buf, valid once fill_buf_ready is set. */
+static uint16_t fill_buf_color;
+static bool fill_buf_ready;
+#endif
+
+#if ST7735_USE_DMA
+/* Transfers shorter than this many pixels are polled, setting up the DMA would cost more. */
+#define ST7735_DMA_MIN_PIXELS 8
+
+/* Set while a DMA transfer is running, cleared by the transfer complete callback. */
+static volatile bool dma_busy;
+
+/* Set while the DMA sends the first pixel again and again, see ST7735_fill_stream(). */
+static bool dma_repeat;
+
+/* Task waiting for the running DMA transfer, NULL when nobody waits. */
+static osThreadId_t volatile dma_waiter;
+#endif
+
+#if ST7735_USE_FRAMEBUFFER
+/**
+ * @brief Rectangle in display coordinates.
+ * @param x0, y0 Top-left corner (inclusive)
+ * @param x1, y1 Bottom-right corner (inclusive)
+ */
+typedef struct {
+	int16_t x0, y0, x1, y1;
+} st7735_rect_t;
+
+#if ST7735_FB_BPP < 16
+/* Framebuffer of palette indices, the leftmost pixel of a byte is stored in its high bits. */
+static uint8_t framebuffer[ST7735_TFTWIDTH_128 * ST7735_TFTHEIGHT_160 * ST7735_FB_BPP / 8];
+
+/* Colors of the palette indices, index 0 is black so that the cleared framebuffer is black. */
+static uint16_t palette[1 << ST7735_FB_BPP] = {ST77XX_BLACK, ST77XX_WHITE};
+
+/* Number of palette entries in use. */
+static uint16_t palette_count = 2;
+
+/* Last color looked up in the palette and its index, drawing mostly repeats colors. */
+static uint16_t palette_last_color = ST77XX_BLACK;
+static uint8_t palette_last_index;
+#else
+/* Framebuffer in native RGB565, sent as is in 16-bit SPI frames. */
+static uint16_t framebuffer[ST7735_TFTWIDTH_128 * ST7735_TFTHEIGHT_160];
+#endif
+
+/* Regions of the framebuffer changed since the last flush. */
+static st7735_rect_t dirty_rects[ST7735_DIRTY_RECTS];
+
+/* Number of valid entries in dirty_rects. */
+static uint8_t dirty_count;
+
+/* Overlay banner composited by ST7735_flush(), valid while overlay_on is set. */
+static st7735_overlay_t overlay;
+static bool overlay_on;
+
+/* Top-left corner and number of characters of the overlay text. */
+static int16_t overlay_text_x, overlay_text_y;
+static uint8_t overlay_text_len;
+#endif
+
+/**
+ * @brief Waits until the running DMA transfer, if any, has completed.
+ * @details The calling task sleeps on ST7735_DMA_FLAG so other tasks can run while pixels are
+ * streamed. Before the kernel is started the completion is polled instead.
+ */
+static void ST7735_dma_wait(void) {
+#if ST7735_USE_DMA
+	while (dma_busy) {
+		if (osKernelGetState() != osKernelRunning)
+			continue;
+
+		/* Register before checking again so the completion can not be missed */
+		dma_waiter = osThreadGetId();
+		osThreadFlagsClear(ST7735_DMA_FLAG);
+		if (dma_busy && osThreadFlagsWait(ST7735_DMA_FLAG, osFlagsWaitAny, 1000) ==
+							osFlagsErrorTimeout) {
+			/* Transfer got stuck, abort it so the bus can be used again */
+			HAL_SPI_Abort(&hspi2);
+			dma_busy = false;
+		}
+	}
+	dma_waiter = NULL;
+#endif
+}
+
+/**
+ * @brief Takes the screen lock for the calling task.
+ * @details The lock nests: a task already holding it only increments the depth, so drawing inside
+ * a ST7735_begin()/ST7735_end() batch costs no RTOS call. Before the kernel is started there is
+ * only one thread of execution and the depth is counted alone.
+ */
+static void ST7735_lock(void) {
+	if (osKernelGetState() != osKernelRunning) {
+		lock_depth++;
+		return;
+	}
+	osThreadId_t self = osThreadGetId();
+	if (lock_owner != self) {
+		osMutexAcquire(ScreenMutexHandle, osWaitForever);
+		lock_owner = self;
+	}
+	lock_depth++;
+}
+
+/**
+ * @brief Releases one level of the screen lock taken with ST7735_lock().
+ * @details The mutex is only released by the task which took it, a depth counted before the
+ * kernel was started has no owner.
+ */
+static void ST7735_unlock(void) {
+	if ((--lock_depth == 0) && (lock_owner != NULL)) {
+		lock_owner = NULL;
+		osMutexRelease(ScreenMutexHandle);
+	}
+}
+
 /**
  * @brief Starts a write operation to the ST7735 display.
  * @details This function asserts the Chip Select (CS) pin to begin communication with the display.
+ * Calls nest, the pin is only driven by the outermost one.
  */
 static void ST7735_start_write(void) {
-	HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET);
+	if (write_depth++ == 0)
+		HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET);
 }
 
 /**
  * @brief Ends a write operation to the ST7735 display.
  * @details This function de-asserts the Chip Select (CS) pin to end communication with the display.
+ * Calls nest, the pin is only released by the outermost one.
  */
 static void ST7735_end_write(void) {
-	HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET);
+	if (--write_depth == 0) {
+		/* Keep the display selected until the last DMA transfer has left the SPI */
+		ST7735_dma_wait();
+		HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET);
+		/* Releasing CS ends the memory write, the window registers are kept */
+		ram_open = false;
+#if ST7735_USE_MIRROR
+		ST7735_mirror_end();
+#endif
+	}
+}
+
+/**
+ * @brief Selects the SPI frame size.
+ * @details Commands and their arguments go out in 8-bit frames. Pixels go out in 16-bit frames,
+ * which the SPI shifts most significant bit first, so RGB565 values are sent straight from memory
+ * without swapping bytes. The frame size can only be changed while the SPI is idle and disabled.
+ * The DMA stream is set up for halfword transfers and is only used for pixels.
+ * @param wide True for 16-bit frames, false for 8-bit frames.
+ */
+static void ST7735_spi_frame16(bool wide) {
+	if (wide == spi_16bit)
+		return;
+
+	/* The running transfer must leave the SPI before the frame format changes */
+	ST7735_dma_wait();
+	__HAL_SPI_DISABLE(&hspi2);
+	if (wide) {
+		hspi2.Init.DataSize = SPI_DATASIZE_16BIT;
+		SET_BIT(hspi2.Instance->CR1, SPI_CR1_DFF);
+	} else {
+		hspi2.Init.DataSize = SPI_DATASIZE_8BIT;
+		CLEAR_BIT(hspi2.Instance->CR1, SPI_CR1_DFF);
+	}
+	/* The HAL enables the SPI again at the start of the next transfer */
+	spi_16bit = wide;
 }
 
 /**
@@ -150,11 +385,27 @@ static void ST7735_start_data(void) {
  * @param command The command byte to be sent to the display.
  */
 static void ST7735_spi_send_com(uint8_t command) {
+	/* A0 must not change while pixel data is still being sent */
+	ST7735_dma_wait();
+	ST7735_spi_frame16(false);
+
+	/* Any command ends a memory write, a reset also clears the window registers */
+	ram_open = (command == ST77XX_RAMWR);
+	ram_bytes = 0;
+	if (command == ST77XX_SWRESET)
+		win_valid = false;
+
 	/* Start command transmission */
 	ST7735_start_command();
+#if ST7735_USE_MIRROR
+	ST7735_mirror_command(command);
+#endif
 
 	/* Transmit command byte */
 	HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi2, &command, 1, 1000);
+	stats.transactions++;
+	stats.bytes++;
+	stats.commands++;
 
 	/* Check transmission status */
 	if (status != HAL_OK) {
@@ -174,11 +425,22 @@ static void ST7735_spi_send_com(uint8_t command) {
  */
 static void ST7735_spi_send_data(uint8_t *data, size_t size) {
 	if (size) {
+		/* Let the running DMA transfer finish first */
+		ST7735_dma_wait();
+		ST7735_spi_frame16(false);
+
 		/* Start data transmission */
 		ST7735_start_data();
+#if ST7735_USE_MIRROR
+		ST7735_mirror_data(data, size);
+#endif
 
 		/* Transmit data bytes */
 		HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi2, data, size, 1000);
+		stats.transactions++;
+		stats.bytes += size;
+		if (ram_open)
+			ram_bytes += size;
 
 		/* Check transmission status */
 		if (status != HAL_OK) {
@@ -190,9 +452,85 @@ static void ST7735_spi_send_data(uint8_t *data, size_t size) {
 	}
 }
 
+/**
+ * @brief Sends one chunk of pixels to the ST7735 display in 16-bit frames.
+ * @details With ST7735_USE_DMA a chunk of at least ST7735_DMA_MIN_PIXELS is sent with DMA and the
+ * function returns as soon as the transfer is started, only the previous transfer is waited for.
+ * Shorter chunks, and every chunk without ST7735_USE_DMA, are sent with polling.
+ * @param pixels Pointer to the RGB565 pixels, must stay untouched until a DMA transfer completes.
+ * @param count Number of pixels.
+ */
+static void ST7735_spi_send_frames(const uint16_t *pixels, uint16_t count) {
+	/* Only one transfer can be in flight */
+	ST7735_dma_wait();
+	ST7735_spi_frame16(true);
+
+	/* Start data transmission */
+	ST7735_start_data();
+#if ST7735_USE_MIRROR && ST7735_USE_DMA
+	ST7735_mirror_pixels(pixels, count, dma_repeat);
+#elif ST7735_USE_MIRROR
+	ST7735_mirror_pixels(pixels, count, false);
+#endif
+	HAL_StatusTypeDef status;
+#if ST7735_USE_DMA
+	if (count >= ST7735_DMA_MIN_PIXELS) {
+		dma_busy = true;
+		status = HAL_SPI_Transmit_DMA(&hspi2, (uint8_t *)pixels, count);
+		if (status != HAL_OK)
+			dma_busy = false;
+	} else
+#endif
+		status = HAL_SPI_Transmit(&hspi2, (uint8_t *)pixels, count, 1000);
+	stats.transactions++;
+	stats.bytes += count * 2;
+	if (ram_open)
+		ram_bytes += count * 2;
+
+	/* Check transmission status */
+	if (status != HAL_OK) {
+		/* If transmission fails, enter an infinite loop */
+		while (1) {
+			/* Infinite loop to handle error */
+		}
+	}
+}
+
+/**
+ * @brief Sends pixels to the ST7735 display.
+ * @details Long runs may still be on the bus when the function returns, so only the line buffers,
+ * the framebuffer and buffers waited for before they change may be passed here.
+ * @param pixels Pointer to the RGB565 pixels.
+ * @param count Number of pixels.
+ */
+static void ST7735_spi_send_pixels(const uint16_t *pixels, uint32_t count) {
+	while (count) {
+		uint16_t chunk = count > ST7735_SPI_MAX_CHUNK ? ST7735_SPI_MAX_CHUNK : count;
+		ST7735_spi_send_frames(pixels, chunk);
+		pixels += chunk;
+		count -= chunk;
+	}
+}
+
+/**
+ * @brief Returns the next line buffer to fill with pixel data.
+ * @details Buffers are handed out alternately and only one DMA transfer runs at a time, so the
+ * returned buffer is never the one on the bus as long as every buffer taken is also sent.
+ * @return Pointer to a buffer of ST7735_LINE_BUF_SIZE pixels.
+ */
+static uint16_t *ST7735_line_buffer(void) {
+	uint16_t *buf = line_buf[line_buf_idx];
+	line_buf_idx ^= 1;
+	return buf;
+}
+
 /**
  * @brief Sets the drawing window on the ST7735 display.
- * @details This function configures the column and row address ranges where subsequent drawing commands will affect.
+ * @details This function configures the column and row address ranges where subsequent drawing
+ * commands will affect. The last window is cached: CASET and RASET are only sent when their range
+ * changes, and no command at all is sent when the window continues the open memory write right
+ * where its cursor stands. Rows are always opened down to the bottom of the display so that
+ * following windows below can continue the stream.
  * @param x Starting X-coordinate of the window.
  * @param y Starting Y-coordinate of the window.
  * @param w Width of the window.
@@ -202,25 +540,419 @@ static void ST7735_set_window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
 	/* Adjust coordinates by start offsets */
 	x += _xstart;
 	y += _ystart;
+	uint16_t x1 = x + w - 1;
+	uint16_t y1 = _ystart + _height - 1;
+	if (y + h - 1 > y1)
+		y1 = y + h - 1;
+
+	/* Keep streaming when the open write has reached the first row of the window */
+	if (ram_open && (x == win_x0) && (x1 == win_x1)) {
+		uint32_t pixels = ram_bytes / 2;
+		if ((pixels % w == 0) && (win_y0 + pixels / w == y) && (y + h - 1 <= win_y1)) {
+			stats.commands_saved += 3;
+			return;
+		}
+	}
 
-	/* Prepare column address data */
-	uint8_t xa[4] = {x >> 8, x, (x + w - 1) >> 8, (x + w - 1)};
-
-	/* Prepare row address data */
-	uint8_t ya[4] = {y >> 8, y, (y + h - 1) >> 8, (y + h - 1)};
-
-	/* Set column address */
-	ST7735_spi_send_com(ST77XX_CASET);
-	ST7735_spi_send_data(xa, 4);
+	if (!win_valid || (x != win_x0) || (x1 != win_x1)) {
+		/* Set column address */
+		uint8_t xa[4] = {x >> 8, x, x1 >> 8, x1};
+		ST7735_spi_send_com(ST77XX_CASET);
+		ST7735_spi_send_data(xa, 4);
+		win_x0 = x;
+		win_x1 = x1;
+	} else {
+		stats.commands_saved++;
+	}
 
-	/* Set row address */
-	ST7735_spi_send_com(ST77XX_RASET);
-	ST7735_spi_send_data(ya, 4);
+	if (!win_valid || (y != win_y0) || (y1 != win_y1)) {
+		/* Set row address */
+		uint8_t ya[4] = {y >> 8, y, y1 >> 8, y1};
+		ST7735_spi_send_com(ST77XX_RASET);
+		ST7735_spi_send_data(ya, 4);
+		win_y0 = y;
+		win_y1 = y1;
+	} else {
+		stats.commands_saved++;
+	}
+	win_valid = true;
 
 	/* Write to memory */
 	ST7735_spi_send_com(ST77XX_RAMWR);
 }
 
+#if !ST7735_USE_FRAMEBUFFER
+/**
+ * @brief Streams a solid color into the current address window.
+ * @details With ST7735_USE_DMA the color is kept in one halfword and the DMA sends it again and
+ * again in 16-bit frames with memory increment (MINC) cleared, so any color streams without a
+ * buffer. A run is split into transfers of at most ST7735_SPI_MAX_CHUNK pixels, the last one kept
+ * at least ST7735_DMA_MIN_PIXELS long; runs shorter than that are sent polled from a small local
+ * buffer. Without DMA a chunk buffer of ST7735_FILL_BUF_SIZE pixels, preset with the color and
+ * only refilled when the color changes, is sent as many times as needed.
+ * @param color Fill color.
+ * @param count Number of pixels to send.
+ */
+static void ST7735_fill_stream(uint16_t color, uint32_t count) {
+#if ST7735_USE_DMA
+	if (count < ST7735_DMA_MIN_PIXELS) {
+		/* Polled, the pixels are sent before returning */
+		uint16_t run[ST7735_DMA_MIN_PIXELS];
+		for (uint32_t i = 0; i < count; i++)
+			run[i] = color;
+		ST7735_spi_send_pixels(run, count);
+		return;
+	}
+
+	/* Source of the fixed-address transfer, must outlive it */
+	static uint16_t fill_pixel;
+
+	ST7735_dma_wait();
+	fill_pixel = color;
+	CLEAR_BIT(hspi2.hdmatx->Instance->CR, DMA_SxCR_MINC);
+	dma_repeat = true;
+	while (count) {
+		uint16_t chunk = count > ST7735_SPI_MAX_CHUNK ? ST7735_SPI_MAX_CHUNK : count;
+		/* Keep the tail long enough for DMA, a polled tail would read past fill_pixel */
+		if ((count > chunk) && (count - chunk < ST7735_DMA_MIN_PIXELS))
+			chunk -= ST7735_DMA_MIN_PIXELS;
+		ST7735_spi_send_frames(&fill_pixel, chunk);
+		count -= chunk;
+	}
+	ST7735_dma_wait();
+	SET_BIT(hspi2.hdmatx->Instance->CR, DMA_SxCR_MINC);
+	dma_repeat = false;
+#else
+	/* Preset the chunk buffer, it is only rewritten when the color changes */
+	if (!fill_buf_ready || (fill_buf_color != color)) {
+		for (uint16_t i = 0; i < ST7735_FILL_BUF_SIZE; i++)
+			fill_buf[i] = color;
+		fill_buf_color = color;
+		fill_buf_ready = true;
+	}
+	while (count) {
+		uint32_t n = count > ST7735_FILL_BUF_SIZE ? ST7735_FILL_BUF_SIZE : count;
+		ST7735_spi_send_pixels(fill_buf, n);
+		count -= n;
+	}
+#endif
+}
+#endif
+
+/**
+ * @brief Clips a rectangle to the display area.
+ * @param[in,out] x, y Top-left corner of the rectangle.
+ * @param[in,out] w, h Dimensions of the rectangle.
+ * @return True if some part of the rectangle is visible, false otherwise.
+ */
+static bool ST7735_clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h) {
+	if (*x < 0) {
+		*w += *x;
+		*x = 0;
+	}
+	if (*y < 0) {
+		*h += *y;
+		*y = 0;
+	}
+	if (*x + *w > _width)
+		*w = _width - *x;
+	if (*y + *h > _height)
+		*h = _height - *y;
+	return (*w > 0) && (*h > 0);
+}
+
+#if ST7735_USE_FRAMEBUFFER
+/**
+ * @brief Calculates the area of a rectangle.
+ * @param[in] r Pointer to the rectangle.
+ * @return Area in pixels.
+ */
+static uint32_t ST7735_rect_area(const st7735_rect_t *r) {
+	return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+/**
+ * @brief Extends a rectangle so that it also covers another one.
+ * @param[in,out] dst Pointer to the rectangle to extend.
+ * @param[in] src Pointer to the rectangle to cover.
+ */
+static void ST7735_rect_union(st7735_rect_t *dst, const st7735_rect_t *src) {
+	if (src->x0 < dst->x0)
+		dst->x0 = src->x0;
+	if (src->y0 < dst->y0)
+		dst->y0 = src->y0;
+	if (src->x1 > dst->x1)
+		dst->x1 = src->x1;
+	if (src->y1 > dst->y1)
+		dst->y1 = src->y1;
+}
+
+/**
+ * @brief Checks whether two rectangles overlap or share an edge.
+ * @param[in] a, b Pointers to the rectangles.
+ * @return True if the rectangles overlap or touch, false otherwise.
+ */
+static bool ST7735_rect_touch(const st7735_rect_t *a, const st7735_rect_t *b) {
+	return (a->x0 <= b->x1 + 1) && (b->x0 <= a->x1 + 1) && (a->y0 <= b->y1 + 1) &&
+		   (b->y0 <= a->y1 + 1);
+}
+
+/**
+ * @brief Adds a clipped region to the dirty rectangle list.
+ * @details Rectangles touching the region are merged into it. When the list is full, the region
+ * is merged with the rectangle whose bounding box grows the least.
+ * @param x, y Top-left corner of the region.
+ * @param w, h Dimensions of the region.
+ */
+static void ST7735_mark_dirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+	st7735_rect_t r = {x, y, x + w - 1, y + h - 1};
+
+	for (;;) {
+		/* Absorb every rectangle touching the region */
+		for (uint8_t i = 0; i < dirty_count;) {
+			if (ST7735_rect_touch(&dirty_rects[i], &r)) {
+				ST7735_rect_union(&r, &dirty_rects[i]);
+				dirty_rects[i] = dirty_rects[--dirty_count];
+				i = 0;
+			} else {
+				i++;
+			}
+		}
+		if (dirty_count < ST7735_DIRTY_RECTS)
+			break;
+
+		/* List is full: merge with the cheapest rectangle and retry */
+		uint8_t best = 0;
+		uint32_t best_growth = UINT32_MAX;
+		for (uint8_t i = 0; i < dirty_count; i++) {
+			st7735_rect_t u = dirty_rects[i];
+			ST7735_rect_union(&u, &r);
+			uint32_t growth = ST7735_rect_area(&u) - ST7735_rect_area(&dirty_rects[i]);
+			if (growth < best_growth) {
+				best_growth = growth;
+				best = i;
+			}
+		}
+		ST7735_rect_union(&r, &dirty_rects[best]);
+		dirty_rects[best] = dirty_rects[--dirty_count];
+	}
+	dirty_rects[dirty_count++] = r;
+}
+
+/**
+ * @brief Converts a color to the value stored in the framebuffer.
+ * @details With a palettized framebuffer the color is looked up in the palette. A color not in the
+ * palette yet takes a free entry, once the palette is full it is mapped to the closest entry.
+ * Without palette the color is stored as is.
+ * @param color RGB565 color.
+ * @return Palette index or RGB565 color.
+ */
+static uint16_t ST7735_fb_value(uint16_t color) {
+#if ST7735_FB_BPP < 16
+	if (color == palette_last_color)
+		return palette_last_index;
+
+	uint16_t best = 0;
+	uint32_t best_dist = UINT32_MAX;
+	for (uint16_t i = 0; i < palette_count; i++) {
+		if (palette[i] == color) {
+			best = i;
+			best_dist = 0;
+			break;
+		}
+		/* Distance in 6-bit steps for every component */
+		int32_t dr = ((palette[i] >> 11) - (color >> 11)) * 2;
+		int32_t dg = ((palette[i] >> 5) & 0x3F) - ((color >> 5) & 0x3F);
+		int32_t db = ((palette[i] & 0x1F) - (color & 0x1F)) * 2;
+		uint32_t dist = dr * dr + dg * dg + db * db;
+		if (dist < best_dist) {
+			best_dist = dist;
+			best = i;
+		}
+	}
+	if (best_dist && (palette_count < (1 << ST7735_FB_BPP))) {
+		best = palette_count++;
+		palette[best] = color;
+	}
+	palette_last_color = color;
+	palette_last_index = best;
+	return best;
+#else
+	return color;
+#endif
+}
+
+/**
+ * @brief Stores a pixel in the framebuffer.
+ * @param x, y Pixel location, must be on the display.
+ * @param value Value returned by ST7735_fb_value().
+ */
+static void ST7735_fb_put(int16_t x, int16_t y, uint16_t value) {
+#if ST7735_FB_BPP == 4
+	/* Rows hold an even number of pixels, so the pixel parity gives the nibble */
+	uint8_t *p = &framebuffer[(y * _width + x) / 2];
+	*p = (x & 1) ? ((*p & 0xF0) | value) : ((*p & 0x0F) | (value << 4));
+#else
+	framebuffer[y * _width + x] = value;
+#endif
+}
+
+/**
+ * @brief Stores a horizontal run of one value in the framebuffer.
+ * @param x, y Leftmost pixel of the run, must be on the display.
+ * @param w Length of the run, must fit on the display.
+ * @param value Value returned by ST7735_fb_value().
+ */
+static void ST7735_fb_span(int16_t x, int16_t y, int16_t w, uint16_t value) {
+#if ST7735_FB_BPP == 4
+	if ((x & 1) && (w > 0)) {
+		ST7735_fb_put(x++, y, value);
+		w--;
+	}
+	/* Whole bytes in the middle of the run */
+	memset(&framebuffer[(y * _width + x) / 2], value * 0x11, w / 2);
+	if (w & 1)
+		ST7735_fb_put(x + w - 1, y, value);
+#elif ST7735_FB_BPP == 8
+	memset(&framebuffer[y * _width + x], value, w);
+#else
+	uint16_t *row = &framebuffer[y * _width + x];
+	for (int16_t i = 0; i < w; i++)
+		row[i] = value;
+#endif
+}
+
+#if ST7735_FB_BPP < 16
+/**
+ * @brief Expands a run of framebuffer pixels to RGB565 through the palette.
+ * @param x, y Leftmost pixel of the run.
+ * @param w Length of the run.
+ * @param[out] out Buffer for w RGB565 pixels.
+ */
+static void ST7735_fb_expand(int16_t x, int16_t y, int16_t w, uint16_t *out) {
+#if ST7735_FB_BPP == 4
+	uint32_t n = y * _width + x;
+	for (int16_t i = 0; i < w; i++, n++) {
+		uint8_t b = framebuffer[n / 2];
+		out[i] = palette[(n & 1) ? (b & 0x0F) : (b >> 4)];
+	}
+#else
+	const uint8_t *src = &framebuffer[y * _width + x];
+	for (int16_t i = 0; i < w; i++)
+		out[i] = palette[src[i]];
+#endif
+}
+#endif
+
+/**
+ * @brief Fills a rectangle of the framebuffer and marks it dirty.
+ * @param x, y Top-left corner of the rectangle.
+ * @param w, h Dimensions of the rectangle.
+ * @param color Fill color.
+ */
+static void ST7735_fb_fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+	if (!ST7735_clip(&x, &y, &w, &h))
+		return;
+
+	uint16_t value = ST7735_fb_value(color);
+	for (int16_t j = y; j < y + h; j++)
+		ST7735_fb_span(x, j, w, value);
+	ST7735_mark_dirty(x, y, w, h);
+}
+
+#if ST7735_FB_BPP == 16
+/**
+ * @brief Tells whether the overlay covers part of a rectangle.
+ * @param r The rectangle.
+ */
+static bool ST7735_overlay_hits(const st7735_rect_t *r) {
+	return overlay_on && (overlay.x <= r->x1) && (r->x0 < overlay.x + overlay.w) &&
+		   (overlay.y <= r->y1) && (r->y0 < overlay.y + overlay.h);
+}
+#endif
+
+/**
+ * @brief Composites the overlay into a row of pixels about to be sent.
+ * @param x, y Leftmost pixel of the row.
+ * @param w Length of the row.
+ * @param[in,out] buf RGB565 pixels of the row.
+ */
+static void ST7735_overlay_row(int16_t x, int16_t y, int16_t w, uint16_t *buf) {
+	if (!overlay_on || (y < overlay.y) || (y >= overlay.y + overlay.h))
+		return;
+	int16_t x0 = x > overlay.x ? x : overlay.x;
+	int16_t x1 = x + w < overlay.x + overlay.w ? x + w : overlay.x + overlay.w;
+	int16_t gy = y - overlay_text_y;
+
+	for (int16_t px = x0; px < x1; px++) {
+		uint16_t pixel = overlay.bg;
+		int16_t cx = px - overlay_text_x;
+		if ((gy >= 0) && (gy < 8) && (cx >= 0) && (cx < overlay_text_len * 6) && (cx % 6 < 5)) {
+			unsigned char c = overlay.text[cx / 6];
+			/* Same code adjustment as ST7735_char() */
+			if (c >= 176)
+				c++;
+			if (font[c * 5 + cx % 6] & (1 << gy))
+				pixel = overlay.color;
+		}
+		buf[px - x] = pixel;
+	}
+}
+
+/**
+ * @brief Marks the visible part of the overlay dirty.
+ */
+static void ST7735_overlay_mark(void) {
+	int16_t x = overlay.x, y = overlay.y, w = overlay.w, h = overlay.h;
+	if (ST7735_clip(&x, &y, &w, &h))
+		ST7735_mark_dirty(x, y, w, h);
+}
+#endif
+
+/**
+ * @brief Fills a rectangle with a solid color, without taking the screen mutex.
+ * @param x, y Top-left corner of the rectangle.
+ * @param w, h Dimensions of the rectangle, clipped to the display.
+ * @param color Fill color.
+ */
+static void ST7735_fill_area(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+#if ST7735_USE_FRAMEBUFFER
+	ST7735_fb_fill(x, y, w, h, color);
+#else
+	if (!ST7735_clip(&x, &y, &w, &h))
+		return;
+	/* Start writing to the display */
+	ST7735_start_write();
+	/* Set the window to the rectangle location */
+	ST7735_set_window(x, y, w, h);
+	ST7735_fill_stream(color, (uint32_t)w * h);
+	/* End writing to the display */
+	ST7735_end_write();
+#endif
+}
+
+/**
+ * @brief Draws a single pixel, without taking the screen lock.
+ * @param x, y Coordinates of the pixel, ignored when off-screen.
+ * @param color Pixel color.
+ */
+static void ST7735_draw_pixel(int16_t x, int16_t y, uint16_t color) {
+	if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height))
+		return;
+#if ST7735_USE_FRAMEBUFFER
+	ST7735_fb_fill(x, y, 1, 1, color);
+#else
+	/* Start writing to the display */
+	ST7735_start_write();
+	/* Set the window to the pixel location */
+	ST7735_set_window(x, y, 1, 1);
+	/* Send the pixel color data, a single pixel is polled */
+	ST7735_spi_send_pixels(&color, 1);
+	/* End writing to the display */
+	ST7735_end_write();
+#endif
+}
+
 int ST7735_init(void) {
 	uint8_t num_commands, cmd, numArgs;
 	uint16_t ms;
@@ -267,10 +999,8 @@ int ST7735_init(void) {
 		}
 	}
 
-	ST7735_start_write();
 	/* Set the display rotation */
 	ST7735_set_rotation(2);
-	ST7735_end_write();
 
 	return 0;
 }
@@ -278,6 +1008,7 @@ int ST7735_init(void) {
 int ST7735_set_rotation(int m) {
 	uint8_t madctl = 0;
 
+	ST7735_begin();
 	/* Ensure rotation value is between 0 and 3 */
 	rotation = m & 3;
 
@@ -320,102 +1051,135 @@ int ST7735_set_rotation(int m) {
 	ST7735_spi_send_com(ST77XX_MADCTL);
 	/* Send the MADCTL data to the display */
 	ST7735_spi_send_data(&madctl, 1);
+#if ST7735_USE_FRAMEBUFFER
+	/* The framebuffer layout follows the rotation, the whole screen has to be resent */
+	dirty_count = 0;
+	ST7735_mark_dirty(0, 0, _width, _height);
+#endif
+	ST7735_end();
 	return 0;
 }
 
-void ST7735_pixel(int16_t x, int16_t y, uint16_t color) {
-	osMutexAcquire(ScreenMutexHandle, osWaitForever);
-	if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
-		/* Start writing to the display */
-		ST7735_start_write();
-		/* Set the window to the pixel location */
-		ST7735_set_window(x, y, 1, 1);
-		/* Start data transmission */
-		ST7735_start_data();
-		uint8_t c[2] = {color >> 8, color};
-		/* Send the pixel color data */
-		ST7735_spi_send_data(c, 2);
-		/* End writing to the display */
-		ST7735_end_write();
+/**
+ * @brief Tells whether frame memory lines run against the display coordinates.
+ * @details The row order is mirrored by MADCTL MY in rotations 0 and 1.
+ */
+static bool ST7735_scroll_reversed(void) {
+	return rotation < 2;
+}
+
+/**
+ * @brief Sends a command with 16-bit arguments.
+ * @param cmd The command.
+ * @param args The arguments.
+ * @param count Number of arguments.
+ */
+static void ST7735_send_com_args16(uint8_t cmd, const uint16_t *args, uint8_t count) {
+	uint8_t data[6];
+	for (uint8_t i = 0; i < count; i++) {
+		data[2 * i] = args[i] >> 8;
+		data[2 * i + 1] = args[i];
 	}
-	osMutexRelease(ScreenMutexHandle);
+	ST7735_spi_send_com(cmd);
+	ST7735_spi_send_data(data, count * 2);
 }
 
-void ST7735_vline(uint16_t x, uint16_t y, uint16_t h, uint16_t color) {
-	osMutexAcquire(ScreenMutexHandle, osWaitForever);
-	/* Start writing to the display */
+void ST7735_scroll_area(int16_t start, uint16_t length) {
+	uint16_t axis_start = (rotation & 1) ? _xstart : _ystart;
+
+	ST7735_begin();
+	if (length == 0) {
+		/* A single band over the whole memory, shown from its first line, is no scrolling */
+		scroll_first = 0;
+		scroll_lines = ST7735_MEMORY_LINES;
+	} else if (ST7735_scroll_reversed()) {
+		scroll_first = ST7735_MEMORY_LINES - axis_start - start - length;
+		scroll_lines = length;
+	} else {
+		scroll_first = axis_start + start;
+		scroll_lines = length;
+	}
+	scroll_address = scroll_first;
+	uint16_t args[3] = {scroll_first, scroll_lines,
+			ST7735_MEMORY_LINES - scroll_first - scroll_lines};
+	ST7735_send_com_args16(ST77XX_VSCRDEF, args, 3);
+	ST7735_send_com_args16(ST77XX_VSCRSADD, &scroll_address, 1);
+	ST7735_end();
+}
+
+void ST7735_scroll(uint16_t line) {
+	/* Lines drawn into the framebuffer have to reach the display memory first */
+	ST7735_flush();
+
+	ST7735_begin();
+	/* Frame memory lines running against the display are shown from the other end */
+	uint16_t offset = line % scroll_lines;
+	if (ST7735_scroll_reversed() && offset)
+		offset = scroll_lines - offset;
+	scroll_address = scroll_first + offset;
+	ST7735_send_com_args16(ST77XX_VSCRSADD, &scroll_address, 1);
+	ST7735_end();
+}
+
+int16_t ST7735_scroll_coord(uint16_t line, uint16_t count) {
+	(void)count;
+	uint16_t axis_start = (rotation & 1) ? _xstart : _ystart;
+	/* Lines are numbered along the display coordinates, from the band start on */
+	int16_t start = scroll_first - axis_start;
+	if (ST7735_scroll_reversed())
+		start = ST7735_MEMORY_LINES - axis_start - scroll_first - scroll_lines;
+	return start + line % scroll_lines;
+}
+
+bool ST7735_scroll_horizontal(void) {
+	return rotation & 1;
+}
+
+void ST7735_begin(void) {
+	ST7735_lock();
 	ST7735_start_write();
-	/* Set the window to the vertical line location */
-	ST7735_set_window(x, y, 1, h);
-	/* Start data transmission */
-	ST7735_start_data();
-	uint8_t c[2] = {color >> 8, color};
-	do
-		/* Send the line color data */
-		ST7735_spi_send_data(c, 2);
-	while (h--);
-	/* End writing to the display */
+}
+
+void ST7735_end(void) {
 	ST7735_end_write();
-	osMutexRelease(ScreenMutexHandle);
+	ST7735_unlock();
+}
+
+void ST7735_pixel(int16_t x, int16_t y, uint16_t color) {
+	ST7735_lock();
+	ST7735_draw_pixel(x, y, color);
+	ST7735_unlock();
+}
+
+void ST7735_vline(uint16_t x, uint16_t y, uint16_t h, uint16_t color) {
+	ST7735_lock();
+	ST7735_fill_area(x, y, 1, h, color);
+	ST7735_unlock();
 }
 
 void ST7735_hline(uint16_t x, uint16_t y, uint16_t w, uint16_t color) {
-	osMutexAcquire(ScreenMutexHandle, osWaitForever);
-	/* Start writing to the display */
-	ST7735_start_write();
-	/* Set the window to the horizontal line location */
-	ST7735_set_window(x, y, w, 1);
-	/* Start data transmission */
-	ST7735_start_data();
-	uint8_t c[2] = {color >> 8, color};
-	do
-		/* Send the line color data */
-		ST7735_spi_send_data(c, 2);
-	while (w--);
-	/* End writing to the display */
-	ST7735_end_write();
-	osMutexRelease(ScreenMutexHandle);
+	ST7735_lock();
+	ST7735_fill_area(x, y, w, 1, color);
+	ST7735_unlock();
 }
 
 void ST7735_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-	/* Draw the left vertical line of the rectangle */
-	ST7735_vline(x, y, h, color);
-	/* Draw the right vertical line of the rectangle */
-	ST7735_vline(x + w, y, h, color);
+	ST7735_begin();
 	/* Draw the top horizontal line of the rectangle */
-	ST7735_hline(x, y, w, color);
+	ST7735_fill_area(x, y, w, 1, color);
 	/* Draw the bottom horizontal line of the rectangle */
-	ST7735_hline(x, y + h, w, color);
+	ST7735_fill_area(x, y + h - 1, w, 1, color);
+	/* Draw the left vertical line of the rectangle */
+	ST7735_fill_area(x, y, 1, h, color);
+	/* Draw the right vertical line of the rectangle */
+	ST7735_fill_area(x + w - 1, y, 1, h, color);
+	ST7735_end();
 }
 
 void ST7735_fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-	osMutexAcquire(ScreenMutexHandle, osWaitForever);
-	/* Ensure x is within bounds */
-	if (x < 0)
-		x = 0;
-	/* Ensure y is within bounds */
-	if (y < 0)
-		y = 0;
-	/* Adjust width if it goes beyond the display width */
-	if (x + w > _width)
-		w = _width - x;
-	/* Adjust height if it goes beyond the display height */
-	if (y + h > _height)
-		h = _height - y;
-	/* Start writing to the display */
-
-	ST7735_start_write();
-	/* Set the window to the rectangle location */
-	ST7735_set_window(x, y, w, h);
-	/* Color data for the rectangle */
-	uint8_t c[2] = {color >> 8, color};
-	uint32_t cnt = w * h;
-	while (cnt--)
-		/* Send the rectangle color data */
-		ST7735_spi_send_data(c, 2);
-	/* End writing to the display */
-	ST7735_end_write();
-	osMutexRelease(ScreenMutexHandle);
+	ST7735_lock();
+	ST7735_fill_area(x, y, w, h, color);
+	ST7735_unlock();
 }
 
 void ST7735_fill(uint16_t color) {
@@ -423,6 +1187,140 @@ void ST7735_fill(uint16_t color) {
 	ST7735_fill_rect(0, 0, _width, _height, color);
 }
 
+void ST7735_blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+	int16_t vx = x, vy = y, vw = w, vh = h;
+	if (!ST7735_clip(&vx, &vy, &vw, &vh))
+		return;
+
+	ST7735_begin();
+#if ST7735_USE_FRAMEBUFFER
+	for (int16_t j = 0; j < vh; j++) {
+		const uint16_t *src = &pixels[(vy - y + j) * w + (vx - x)];
+#if ST7735_FB_BPP < 16
+		for (int16_t i = 0; i < vw; i++)
+			ST7735_fb_put(vx + i, vy + j, ST7735_fb_value(src[i]));
+#else
+		memcpy(&framebuffer[(vy + j) * _width + vx], src, vw * sizeof(uint16_t));
+#endif
+	}
+	ST7735_mark_dirty(vx, vy, vw, vh);
+#else
+	ST7735_set_window(vx, vy, vw, vh);
+	if (vw == w) {
+		/* Unclipped rows are contiguous in the image */
+		ST7735_spi_send_pixels(&pixels[(vy - y) * w], vw * vh);
+	} else {
+		for (int16_t j = 0; j < vh; j++)
+			ST7735_spi_send_pixels(&pixels[(vy - y + j) * w + (vx - x)], vw);
+	}
+	/* The pixels are read straight from the image, it may change once this returns */
+	ST7735_dma_wait();
+#endif
+	ST7735_end();
+}
+
+/**
+ * @brief Draws a run of image pixels on one row, clipped to the display.
+ * @details Runs of following rows with the same columns continue the memory write of the cached
+ * window, so a clipped image costs few commands. In framebuffer mode the caller marks the dirty
+ * region.
+ * @param x, y Leftmost pixel of the run.
+ * @param n Length of the run.
+ * @param pixels RGB565 pixels of the run, NULL for a run of one color.
+ * @param color Color of the run when pixels is NULL.
+ */
+static void ST7735_image_run(int16_t x, int16_t y, int16_t n, const uint16_t *pixels,
+		uint16_t color) {
+	int16_t vx = x, vy = y, vw = n, vh = 1;
+	if (!ST7735_clip(&vx, &vy, &vw, &vh))
+		return;
+	if (pixels)
+		pixels += vx - x;
+#if ST7735_USE_FRAMEBUFFER
+	if (!pixels) {
+		ST7735_fb_span(vx, vy, vw, ST7735_fb_value(color));
+	} else {
+		for (int16_t i = 0; i < vw; i++)
+			ST7735_fb_put(vx + i, vy, ST7735_fb_value(pixels[i]));
+	}
+#else
+	ST7735_set_window(vx, vy, vw, 1);
+	if (pixels)
+		ST7735_spi_send_pixels(pixels, vw);
+	else
+		ST7735_fill_stream(color, vw);
+#endif
+}
+
+void ST7735_image(int16_t x, int16_t y, const st7735_image_t *image, uint16_t color, uint16_t bg) {
+	int16_t vx = x, vy = y, vw = image->w, vh = image->h;
+	if (!ST7735_clip(&vx, &vy, &vw, &vh))
+		return;
+	bool transparent = (image->format == ST7735_IMAGE_RLE1) && (color == bg);
+	/* Without clipping nor skipped runs the image is one continuous memory write */
+	bool stream = !ST7735_USE_FRAMEBUFFER && !transparent && (vw == image->w) &&
+				  (vh == image->h);
+	const uint16_t *words = image->data;
+	const uint8_t *bytes = image->data;
+	uint32_t total = (uint32_t)image->w * image->h;
+	bool ink = false;
+
+	ST7735_begin();
+	if (stream)
+		ST7735_set_window(x, y, image->w, image->h);
+	for (uint32_t pos = 0; pos < total;) {
+		const uint16_t *pixels = NULL;
+		uint16_t run_color = 0;
+		uint32_t n;
+		if (image->format == ST7735_IMAGE_RLE565) {
+			uint16_t header = *words++;
+			n = (header & 0x7FFF) + 1;
+			if (header & 0x8000) {
+				run_color = *words++;
+			} else {
+				pixels = words;
+				words += n;
+			}
+		} else {
+			n = *bytes++;
+			run_color = ink ? color : bg;
+			ink = !ink;
+			if (transparent && ink) {
+				/* Background run of a transparent image, leave it */
+				pos += n;
+				continue;
+			}
+		}
+		if (n == 0)
+			continue;
+
+#if !ST7735_USE_FRAMEBUFFER
+		if (stream) {
+			if (pixels)
+				ST7735_spi_send_pixels(pixels, n);
+			else
+				ST7735_fill_stream(run_color, n);
+			pos += n;
+			continue;
+		}
+#endif
+		/* Split the run at the ends of the rows */
+		while (n) {
+			uint16_t col = pos % image->w;
+			uint32_t k = (n < image->w - col) ? n : image->w - col;
+			ST7735_image_run(x + col, y + pos / image->w, k, pixels, run_color);
+			if (pixels)
+				pixels += k;
+			pos += k;
+			n -= k;
+		}
+	}
+#if ST7735_USE_FRAMEBUFFER
+	ST7735_mark_dirty(vx, vy, vw, vh);
+#endif
+	ST7735_end();
+}
+
 void ST7735_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
 	/* Determine if the line is steep */
 	int16_t steep = abs(y1 - y0) > abs(x1 - x0);
@@ -453,74 +1351,83 @@ void ST7735_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 		ystep = -1;
 	}
 
-	/* Draw the line */
+	/* Draw the line as runs of pixels sharing the same minor coordinate */
+	int16_t run = x0;
+	ST7735_begin();
 	for (; x0 <= x1; x0++) {
-		if (steep) {
-			ST7735_pixel(y0, x0, color);
-		} else {
-			ST7735_pixel(x0, y0, color);
-		}
 		err -= dy;
+		if ((err < 0) || (x0 == x1)) {
+			/* The run ends here, send it as a single span */
+			if (steep) {
+				ST7735_fill_area(y0, run, 1, x0 - run + 1, color);
+			} else {
+				ST7735_fill_area(run, y0, x0 - run + 1, 1, color);
+			}
+			run = x0 + 1;
+		}
 		if (err < 0) {
 			y0 += ystep;
 			err += dx;
 		}
 	}
+	ST7735_end();
 }
 
-void ST7735_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-	/* Initial decision parameter for Bresenham's circle algorithm */
-	int16_t f = 1 - r;
-	int16_t ddF_x = 1;
-	int16_t ddF_y = -2 * r;
-	int16_t x = 0;
-	int16_t y = r;
-
-	/* Start writing to the display */
-	ST7735_start_write();
-	/* Draw the initial points */
-	ST7735_pixel(x0, y0 + r, color);
-	ST7735_pixel(x0, y0 - r, color);
-	ST7735_pixel(x0 + r, y0, color);
-	ST7735_pixel(x0 - r, y0, color);
-
-	/* Draw the circle */
-	while (x < y) {
-		if (f >= 0) {
-			y--;
-			ddF_y += 2;
-			f += ddF_y;
-		}
-		x++;
-		ddF_x += 2;
-		f += ddF_x;
-
-		ST7735_pixel(x0 + x, y0 + y, color);
-		ST7735_pixel(x0 - x, y0 + y, color);
-		ST7735_pixel(x0 + x, y0 - y, color);
-		ST7735_pixel(x0 - x, y0 - y, color);
-		ST7735_pixel(x0 + y, y0 + x, color);
-		ST7735_pixel(x0 - y, y0 + x, color);
-		ST7735_pixel(x0 + y, y0 - x, color);
-		ST7735_pixel(x0 - y, y0 - x, color);
+/**
+ * @brief Draws the spans of one run of the midpoint circle algorithm in all eight octants.
+ * @details A run is the set of octant points (xs..xe, y) sharing the same y. For an outline these
+ * are horizontal spans on rows y0 +- y and vertical spans on columns x0 +- y. For a filled circle
+ * the columns x0 +- (xs..xe) are filled over 2y+1 rows as one block per side, and the columns
+ * x0 +- y over 2xe+1 rows. The caller must hold the screen lock.
+ * @param x0, y0 Center of the circle.
+ * @param xs, xe First and last x offset of the run.
+ * @param y y offset of the run.
+ * @param color Color of the circle.
+ * @param fill True for a filled circle, false for an outline.
+ */
+static void ST7735_circle_run(int16_t x0, int16_t y0, int16_t xs, int16_t xe, int16_t y,
+		uint16_t color, bool fill) {
+	int16_t n = xe - xs + 1;
+	if (fill) {
+		ST7735_fill_area(x0 + xs, y0 - y, n, 2 * y + 1, color);
+		ST7735_fill_area(x0 - xe, y0 - y, n, 2 * y + 1, color);
+		ST7735_fill_area(x0 + y, y0 - xe, 1, 2 * xe + 1, color);
+		ST7735_fill_area(x0 - y, y0 - xe, 1, 2 * xe + 1, color);
+	} else {
+		ST7735_fill_area(x0 + xs, y0 + y, n, 1, color);
+		ST7735_fill_area(x0 - xe, y0 + y, n, 1, color);
+		ST7735_fill_area(x0 + xs, y0 - y, n, 1, color);
+		ST7735_fill_area(x0 - xe, y0 - y, n, 1, color);
+		ST7735_fill_area(x0 + y, y0 + xs, 1, n, color);
+		ST7735_fill_area(x0 + y, y0 - xe, 1, n, color);
+		ST7735_fill_area(x0 - y, y0 + xs, 1, n, color);
+		ST7735_fill_area(x0 - y, y0 - xe, 1, n, color);
 	}
-	/* End writing to the display */
-	ST7735_end_write();
 }
 
-void ST7735_fill_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+/**
+ * @brief Walks the first octant of a circle and draws it run by run.
+ * @param x0, y0 Center of the circle.
+ * @param r Radius of the circle.
+ * @param color Color of the circle.
+ * @param fill True for a filled circle, false for an outline.
+ */
+static void ST7735_circle_walk(int16_t x0, int16_t y0, int16_t r, uint16_t color, bool fill) {
 	/* Initial decision parameter for Bresenham's circle algorithm */
 	int16_t f = 1 - r;
 	int16_t ddF_x = 1;
 	int16_t ddF_y = -2 * r;
 	int16_t x = 0;
 	int16_t y = r;
-	int16_t px = x;
-	int16_t py = y;
+	/* First x offset of the current run */
+	int16_t run = 0;
 
-	/* Draw the filled circle */
+	ST7735_begin();
 	while (x < y) {
 		if (f >= 0) {
+			/* y changes after this point, the run is complete */
+			ST7735_circle_run(x0, y0, run, x, y, color, fill);
+			run = x + 1;
 			y--;
 			ddF_y += 2;
 			f += ddF_y;
@@ -528,19 +1435,17 @@ void ST7735_fill_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
 		x++;
 		ddF_x += 2;
 		f += ddF_x;
-		if (x < (y + 1)) {
-			ST7735_vline(x0 + x, y0 - y, 2 * y + 1, color);
-			ST7735_vline(x0 - x, y0 - y, 2 * y + 1, color);
-		}
-		if (y != py) {
-			ST7735_vline(x0 + py, y0 - px, 2 * px + 1, color);
-			ST7735_vline(x0 - py, y0 - px, 2 * px + 1, color);
-			py = y;
-		}
-		px = x;
 	}
-	/* Draw the central vertical line */
-	ST7735_vline(x0, y0 - r, 2 * r + 1, color);
+	ST7735_circle_run(x0, y0, run, x, y, color, fill);
+	ST7735_end();
+}
+
+void ST7735_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+	ST7735_circle_walk(x0, y0, r, color, false);
+}
+
+void ST7735_fill_circle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+	ST7735_circle_walk(x0, y0, r, color, true);
 }
 
 void ST7735_set_text_color(uint16_t color) {
@@ -551,6 +1456,64 @@ void ST7735_set_text_bg_color(uint16_t color) {
 	textbgcolor = color;
 }
 
+/**
+ * @brief Draws an opaque character cell in a single address window.
+ * @details The 5x8 font columns plus the spacing column are expanded by size_x/size_y into RGB565
+ * pixels row by row. The pixels are streamed through the line buffers, or written to the
+ * framebuffer when it is enabled. Only the visible part of the cell is drawn. The caller must hold
+ * the screen lock.
+ * @param x, y Top-left corner of the character cell.
+ * @param c Font index of the character.
+ * @param color Foreground color.
+ * @param bg Background color.
+ * @param size_x, size_y Magnification factors.
+ */
+static void ST7735_glyph_blit(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+		uint8_t size_x, uint8_t size_y) {
+	int16_t vx = x, vy = y, vw = 6 * size_x, vh = 8 * size_y;
+	if (!ST7735_clip(&vx, &vy, &vw, &vh))
+		return;
+	const uint8_t *glyph = &font[c * 5];
+
+#if ST7735_USE_FRAMEBUFFER
+	uint16_t fg_value = ST7735_fb_value(color);
+	uint16_t bg_value = ST7735_fb_value(bg);
+	for (int16_t py = vy - y; py < vy - y + vh; py++) {
+		uint8_t bit = 1 << (py / size_y);
+		for (int16_t px = vx - x; px < vx - x + vw; px++) {
+			uint8_t col = px / size_x;
+			ST7735_fb_put(x + px, y + py, (col < 5 && (glyph[col] & bit)) ? fg_value : bg_value);
+		}
+	}
+	ST7735_mark_dirty(vx, vy, vw, vh);
+#else
+	/* Start writing to the display */
+	ST7735_start_write();
+	ST7735_set_window(vx, vy, vw, vh);
+	uint16_t *buf = NULL;
+	size_t n = 0;
+	for (int16_t py = vy - y; py < vy - y + vh; py++) {
+		uint8_t bit = 1 << (py / size_y);
+		for (int16_t px = vx - x; px < vx - x + vw; px++) {
+			uint8_t col = px / size_x;
+			uint16_t pixel = (col < 5 && (glyph[col] & bit)) ? color : bg;
+			/* Take a buffer only when there is a pixel to put in it */
+			if (n == 0)
+				buf = ST7735_line_buffer();
+			buf[n++] = pixel;
+			if (n == ST7735_LINE_BUF_SIZE) {
+				ST7735_spi_send_pixels(buf, n);
+				n = 0;
+			}
+		}
+	}
+	if (n)
+		ST7735_spi_send_pixels(buf, n);
+	/* End writing to the display */
+	ST7735_end_write();
+#endif
+}
+
 void ST7735_char(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x,
 		uint8_t size_y) {
 	/* Return if character is completely off-screen */
@@ -561,35 +1524,27 @@ void ST7735_char(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t
 	if (c >= 176)
 		c++;
 
-	ST7735_start_write();
-	/* Draw each column of the character */
-	for (int8_t i = 0; i < 5; i++) {
-		uint8_t line = font[c * 5 + i];
-		/* Draw each pixel in the column */
-		for (int8_t j = 0; j < 8; j++, line >>= 1) {
-			if (line & 1) {
-				/* Draw the foreground pixel */
-				if (size_x == 1 && size_y == 1)
-					ST7735_pixel(x + i, y + j, color);
-				else
-					ST7735_fill_rect(x + i * size_x, y + j * size_y, size_x, size_y, color);
-			} else if (bg != color) {
-				/* Draw the background pixel */
-				if (size_x == 1 && size_y == 1)
-					ST7735_pixel(x + i, y + j, bg);
-				else
-					ST7735_fill_rect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+	ST7735_begin();
+	if (bg != color) {
+		/* An opaque glyph is sent as one block of pixels */
+		ST7735_glyph_blit(x, y, c, color, bg, size_x, size_y);
+	} else {
+		/* Transparent glyph: only the foreground pixels may be touched */
+		for (int8_t i = 0; i < 5; i++) {
+			uint8_t line = font[c * 5 + i];
+			/* Draw each pixel in the column */
+			for (int8_t j = 0; j < 8; j++, line >>= 1) {
+				if (line & 1) {
+					/* Draw the foreground pixel */
+					if (size_x == 1 && size_y == 1)
+						ST7735_draw_pixel(x + i, y + j, color);
+					else
+						ST7735_fill_area(x + i * size_x, y + j * size_y, size_x, size_y, color);
+				}
 			}
 		}
 	}
-	/* Draw the background for the spacing between characters */
-	if (bg != color) {
-		if (size_x == 1 && size_y == 1)
-			ST7735_vline(x + 5, y, 8, bg);
-		else
-			ST7735_fill_rect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
-	}
-	ST7735_end_write();
+	ST7735_end();
 }
 
 void ST7735_putchar(char c) {
@@ -611,10 +1566,13 @@ void ST7735_putchar(char c) {
 }
 
 void ST7735_print(char *text) {
+	/* The whole string is drawn in one batch */
+	ST7735_begin();
 	/* Loop through each character in the text and print it */
 	while (*text) {
 		ST7735_putchar(*text++);
 	}
+	ST7735_end();
 	/* Reset cursor position after printing the text */
 	cursor_x = 0;
 	cursor_y = 0;
@@ -649,4 +1607,338 @@ void ST7735_print_config(int16_t x, int16_t y, char *text, uint16_t color, uint1
 	textsize_x = size_x;
 	textsize_y = size_y;
 	/* Print the text using the specified configuration */
-	ST7735_print(text);}
+	ST7735_print(text);
+}
+
+/**
+ * @brief Finds the glyph of a character in a proportional font.
+ * @param font The font.
+ * @param c The character, characters missing from the font are replaced with '?'.
+ * @return Pointer to the glyph table entry.
+ */
+static const st7735_glyph_t *ST7735_font_glyph(const st7735_font_t *font, unsigned char c) {
+	if ((c < font->first) || (c > font->last))
+		c = ((font->first <= '?') && (font->last >= '?')) ? '?' : font->first;
+	return &font->glyphs[c - font->first];
+}
+
+/**
+ * @brief Returns a glyph expanded to row bit masks.
+ * @details The glyph is taken from the cache, or decoded from its runs into the least recently
+ * used entry. Entries used after the stamp pinned are kept, so up to ST7735_GLYPH_CACHE glyphs
+ * fetched since then stay valid together. The caller must hold the screen lock.
+ * @param font The font.
+ * @param c The character.
+ * @param pinned Clock value before the first glyph which must stay valid.
+ * @return Pointer to the cache entry.
+ */
+static const st7735_glyph_cache_t *ST7735_glyph_get(const st7735_font_t *font, unsigned char c,
+		uint32_t pinned) {
+	st7735_glyph_cache_t *entry = NULL;
+	for (uint8_t i = 0; i < ST7735_GLYPH_CACHE; i++) {
+		st7735_glyph_cache_t *e = &glyph_cache[i];
+		if ((e->font == font) && (e->c == c)) {
+			e->stamp = ++glyph_cache_clock;
+			return e;
+		}
+		if ((e->stamp <= pinned) && (!entry || (e->stamp < entry->stamp)))
+			entry = e;
+	}
+
+	/* Cache miss: decode the runs, they alternate between background and ink */
+	const st7735_glyph_t *glyph = ST7735_font_glyph(font, c);
+	const uint8_t *run = &font->bitmap[glyph->offset];
+	uint16_t total = glyph->width * font->height;
+	bool ink = false;
+	memset(entry->rows, 0, sizeof(entry->rows));
+	for (uint16_t pos = 0; pos < total; ink = !ink) {
+		uint8_t n = *run++;
+		for (; ink && n; n--, pos++)
+			entry->rows[pos / glyph->width] |= 0x80000000UL >> (pos % glyph->width);
+		pos += n;
+	}
+	entry->font = font;
+	entry->c = c;
+	entry->width = glyph->width;
+	entry->stamp = ++glyph_cache_clock;
+	return entry;
+}
+
+/**
+ * @brief Draws one row of a group of expanded glyphs.
+ * @param glyphs The glyphs of the group.
+ * @param count Number of glyphs.
+ * @param x The x-coordinate of the first glyph.
+ * @param vx, vw Visible columns of the group.
+ * @param y The y-coordinate of the row on the display.
+ * @param row Row index inside the glyphs.
+ * @param color The color of the text.
+ * @param bg The background color, equal to color for transparent text.
+ */
+static void ST7735_text_row(const st7735_glyph_cache_t **glyphs, uint8_t count, int16_t x,
+		int16_t vx, int16_t vw, int16_t y, uint8_t row, uint16_t color, uint16_t bg) {
+	/* Ink bits of the visible columns, bit i of word i / 32 for column vx + i */
+	uint32_t ink[(ST7735_TFTHEIGHT_160 + 31) / 32] = {0};
+	for (uint8_t g = 0; g < count; x += glyphs[g]->width, g++) {
+		uint32_t bits = glyphs[g]->rows[row];
+		for (int16_t i = 0; bits; i++, bits <<= 1) {
+			int16_t col = x + i - vx;
+			if ((bits & 0x80000000UL) && (col >= 0) && (col < vw))
+				ink[col / 32] |= 1UL << (col % 32);
+		}
+	}
+#define INK(i) ((ink[(i) / 32] >> ((i) % 32)) & 1)
+
+#if !ST7735_USE_FRAMEBUFFER
+	if (color != bg) {
+		/* The group window is open, the row goes out as one run of pixels */
+		uint16_t *buf = ST7735_line_buffer();
+		for (int16_t i = 0; i < vw; i++)
+			buf[i] = INK(i) ? color : bg;
+		ST7735_spi_send_pixels(buf, vw);
+		return;
+	}
+#else
+	uint16_t fg_value = ST7735_fb_value(color);
+	uint16_t bg_value = ST7735_fb_value(bg);
+#endif
+	for (int16_t i = 0; i < vw;) {
+		int16_t start = i;
+		bool on = INK(i);
+		while ((i < vw) && (INK(i) == on))
+			i++;
+#if ST7735_USE_FRAMEBUFFER
+		if (on || (color != bg))
+			ST7735_fb_span(vx + start, y, i - start, on ? fg_value : bg_value);
+#else
+		if (on)
+			ST7735_fill_area(vx + start, y, i - start, 1, color);
+#endif
+	}
+#undef INK
+}
+
+int16_t ST7735_text(int16_t x, int16_t y, const char *text, const st7735_font_t *font,
+		uint16_t color, uint16_t bg) {
+	ST7735_begin();
+	while (*text && (*text != '\r') && (*text != '\n')) {
+		/* Take as many glyphs as the cache can hold at once */
+		const st7735_glyph_cache_t *glyphs[ST7735_GLYPH_CACHE];
+		uint32_t pinned = glyph_cache_clock;
+		uint8_t count = 0;
+		int16_t w = 0;
+		while (*text && (*text != '\r') && (*text != '\n') && (count < ST7735_GLYPH_CACHE)) {
+			glyphs[count] = ST7735_glyph_get(font, *text++, pinned);
+			w += glyphs[count++]->width;
+		}
+
+		int16_t vx = x, vy = y, vw = w, vh = font->height;
+		if (ST7735_clip(&vx, &vy, &vw, &vh)) {
+#if !ST7735_USE_FRAMEBUFFER
+			/* Opaque text fills the whole group window row by row */
+			if (color != bg)
+				ST7735_set_window(vx, vy, vw, vh);
+#endif
+			for (int16_t j = vy; j < vy + vh; j++)
+				ST7735_text_row(glyphs, count, x, vx, vw, j, j - y, color, bg);
+#if ST7735_USE_FRAMEBUFFER
+			ST7735_mark_dirty(vx, vy, vw, vh);
+#endif
+		}
+		x += w;
+	}
+	ST7735_end();
+	return x;
+}
+
+int16_t ST7735_text_width(const char *text, const st7735_font_t *font) {
+	int16_t w = 0;
+	for (; *text && (*text != '\r') && (*text != '\n'); text++)
+		w += ST7735_font_glyph(font, *text)->width;
+	return w;
+}
+
+#if ST7735_USE_FRAMEBUFFER
+/**
+ * @brief Sends the rows of a dirty rectangle through the line buffers.
+ * @details As many rows as fit are placed one after the other in a line buffer and sent in one
+ * transfer, so a narrow rectangle such as a one pixel column goes out at once. The overlay is
+ * composited on the way. One buffer is filled while the other one is sent.
+ * @param r The rectangle, its address window is already open.
+ * @param w Width of the rectangle.
+ */
+static void ST7735_flush_packed(const st7735_rect_t *r, uint16_t w) {
+	for (int16_t y = r->y0; y <= r->y1;) {
+		uint16_t *buf = ST7735_line_buffer();
+		uint16_t n = 0;
+		for (; (y <= r->y1) && (n + w <= ST7735_LINE_BUF_SIZE); y++, n += w) {
+#if ST7735_FB_BPP < 16
+			ST7735_fb_expand(r->x0, y, w, &buf[n]);
+#else
+			memcpy(&buf[n], &framebuffer[y * _width + r->x0], w * sizeof(uint16_t));
+#endif
+			ST7735_overlay_row(r->x0, y, w, &buf[n]);
+		}
+		ST7735_spi_send_pixels(buf, n);
+	}
+}
+#endif
+
+void ST7735_flush(void) {
+#if ST7735_USE_FRAMEBUFFER
+	ST7735_lock();
+	/* Start writing to the display */
+	ST7735_start_write();
+	for (uint8_t i = 0; i < dirty_count; i++) {
+		st7735_rect_t *r = &dirty_rects[i];
+		uint16_t w = r->x1 - r->x0 + 1;
+		uint16_t h = r->y1 - r->y0 + 1;
+
+		/* One address window per dirty rectangle */
+		ST7735_set_window(r->x0, r->y0, w, h);
+#if ST7735_FB_BPP < 16
+		ST7735_flush_packed(r, w);
+#else
+		if ((w == _width) && !ST7735_overlay_hits(r)) {
+			/* Full-width rows are contiguous in the framebuffer */
+			ST7735_spi_send_pixels(&framebuffer[r->y0 * _width], w * h);
+		} else if ((w <= ST7735_LINE_BUF_SIZE / 2) || ST7735_overlay_hits(r)) {
+			ST7735_flush_packed(r, w);
+		} else {
+			/* Deviation from one transfer per rectangle: the rows of a wide rectangle are not
+			 * contiguous in the framebuffer and only one of them fits a line buffer. They go out
+			 * back to back in the window opened above, so such a rectangle costs one extra
+			 * transfer per row, no extra command bytes. */
+			for (int16_t y = r->y0; y <= r->y1; y++)
+				ST7735_spi_send_pixels(&framebuffer[y * _width + r->x0], w);
+		}
+#endif
+	}
+	dirty_count = 0;
+	/* End writing to the display */
+	ST7735_end_write();
+	ST7735_unlock();
+#endif
+}
+
+void ST7735_set_palette(const uint16_t *colors, uint16_t count) {
+#if ST7735_USE_FRAMEBUFFER && (ST7735_FB_BPP < 16)
+	ST7735_lock();
+	if (count > (1 << ST7735_FB_BPP))
+		count = 1 << ST7735_FB_BPP;
+	memcpy(palette, colors, count * sizeof(uint16_t));
+	palette_count = count;
+	/* Forget the cached lookup, its entry may have changed */
+	palette_last_color = palette[0];
+	palette_last_index = 0;
+	/* Pixels keep their indices, the whole screen shows the new colors */
+	ST7735_mark_dirty(0, 0, _width, _height);
+	ST7735_unlock();
+#endif
+}
+
+void ST7735_overlay(const st7735_overlay_t *ov) {
+#if ST7735_USE_FRAMEBUFFER
+	ST7735_lock();
+	/* What the old banner covered is sent again from the framebuffer */
+	if (overlay_on)
+		ST7735_overlay_mark();
+	overlay_on = (ov != NULL);
+	if (overlay_on) {
+		overlay = *ov;
+		overlay.text[ST7735_OVERLAY_TEXT_LEN - 1] = '\0';
+		overlay_text_len = strcspn(overlay.text, "\r\n");
+		overlay_text_x = overlay.x + (overlay.w - overlay_text_len * 6 + 1) / 2;
+		overlay_text_y = overlay.y + (overlay.h - 7) / 2;
+		ST7735_overlay_mark();
+	}
+	ST7735_unlock();
+#endif
+}
+
+void ST7735_mirror(bool on) {
+#if ST7735_USE_MIRROR
+	/* Release a drawing task waiting for stream space before taking the lock it holds */
+	ST7735_mirror_stop();
+	if (!on)
+		return;
+
+	ST7735_begin();
+	ST7735_mirror_start();
+	/* The viewer knows nothing yet, nor may the next window continue an earlier write */
+	win_valid = false;
+	ram_open = false;
+	ST7735_set_rotation(rotation);
+	uint16_t lines = scroll_lines ? scroll_lines : ST7735_MEMORY_LINES;
+	uint16_t args[3] = {scroll_first, lines, ST7735_MEMORY_LINES - scroll_first - lines};
+	ST7735_send_com_args16(ST77XX_VSCRDEF, args, 3);
+	ST7735_send_com_args16(ST77XX_VSCRSADD, &scroll_address, 1);
+	ST7735_end();
+#endif
+}
+
+/**
+ * @brief Waits, with the scheduler once it runs.
+ * @param ms Time to wait in milliseconds.
+ */
+static void ST7735_delay(uint32_t ms) {
+	if (osKernelGetState() == osKernelRunning)
+		osDelay(ms);
+	else
+		HAL_Delay(ms);
+}
+
+void ST7735_sleep(bool on) {
+	ST7735_lock();
+	if (on != sleeping) {
+		ST7735_start_write();
+		if (on) {
+			/* Blank the panel before its booster stops */
+			ST7735_spi_send_com(ST77XX_DISPOFF);
+			ST7735_spi_send_com(ST77XX_SLPIN);
+		} else {
+			ST7735_spi_send_com(ST77XX_SLPOUT);
+		}
+		ST7735_end_write();
+		/* After SLPIN or SLPOUT the supplies need 120 ms to settle */
+		ST7735_delay(120);
+		if (!on) {
+			ST7735_start_write();
+			ST7735_spi_send_com(ST77XX_DISPON);
+			ST7735_end_write();
+		}
+		sleeping = on;
+	}
+	ST7735_unlock();
+}
+
+void ST7735_get_stats(st7735_stats_t *out) {
+	*out = stats;
+}
+
+void ST7735_reset_stats(void) {
+	stats = (st7735_stats_t){0};
+}
+
+#if ST7735_USE_DMA
+/**
+ * @brief Completes a display DMA transfer and wakes the waiting task.
+ * @param hspi Pointer to the SPI handle which caused the callback.
+ */
+static void ST7735_dma_done(SPI_HandleTypeDef *hspi) {
+	if ((hspi == &hspi2) && dma_busy) {
+		dma_busy = false;
+		if (dma_waiter != NULL)
+			osThreadFlagsSet(dma_waiter, ST7735_DMA_FLAG);
+	}
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+	ST7735_dma_done(hspi);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+	/* The waiting task must not sleep until the timeout on a failed transfer */
+	ST7735_dma_done(hspi);
+}
+#endif
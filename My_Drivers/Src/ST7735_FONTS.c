@@ -0,0 +1,939 @@
+/**
+ * Proportional fonts for the ST7735 text engine
+ * Generated by Tools/fontgen.py from ST7735_FONT.c, do not edit.
+ */
+
+#include "ST7735_FONTS.h"
+
+static const uint8_t font_prop8_bitmap[] = {
+		0x18, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x03, 0x00, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x15, 0x01, 0x01, 0x01, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01, 0x01, 0x02, 0x05, 0x02, 0x01, 0x01, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x08, 0x02, 0x01, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x04, 0x03, 0x04, 0x01,
+		0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 0x09, 0x00, 0x02, 0x04, 0x02, 0x02, 0x01, 0x04, 0x01, 0x04,
+		0x01, 0x04, 0x01, 0x04, 0x01, 0x02, 0x02, 0x04, 0x02, 0x07, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01,
+		0x03, 0x01, 0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01,
+		0x03, 0x02, 0x01, 0x01, 0x07, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x13, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01, 0x05, 0x00, 0x01, 0x04,
+		0x01, 0x04, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02, 0x01, 0x07, 0x02, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x02, 0x05, 0x02, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x03, 0x01, 0x09, 0x08, 0x01, 0x05, 0x01, 0x03, 0x05, 0x03, 0x01, 0x05, 0x01, 0x0F, 0x11, 0x02,
+		0x02, 0x02, 0x02, 0x01, 0x02, 0x01, 0x03, 0x12, 0x05, 0x19, 0x0F, 0x02, 0x01, 0x02, 0x04, 0x0A,
+		0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x11, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x03, 0x01, 0x02, 0x03, 0x08, 0x02, 0x01, 0x04, 0x02, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05,
+		0x01, 0x04, 0x03, 0x08, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x05, 0x01, 0x02, 0x03, 0x02, 0x01,
+		0x05, 0x01, 0x05, 0x05, 0x07, 0x00, 0x05, 0x05, 0x01, 0x04, 0x01, 0x04, 0x02, 0x06, 0x01, 0x01,
+		0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x03, 0x01, 0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01,
+		0x02, 0x01, 0x02, 0x05, 0x04, 0x01, 0x05, 0x01, 0x08, 0x00, 0x05, 0x01, 0x01, 0x05, 0x04, 0x06,
+		0x01, 0x05, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x02, 0x03, 0x02, 0x01, 0x04, 0x01,
+		0x05, 0x04, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x00, 0x05, 0x05,
+		0x01, 0x05, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x0B, 0x01, 0x03, 0x02, 0x01,
+		0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x02, 0x03, 0x08, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x04, 0x05,
+		0x01, 0x04, 0x01, 0x02, 0x03, 0x09, 0x04, 0x01, 0x03, 0x01, 0x07, 0x07, 0x01, 0x05, 0x01, 0x02,
+		0x01, 0x01, 0x01, 0x05, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x05, 0x01, 0x06, 0x0C, 0x05, 0x07, 0x05, 0x13, 0x00, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x09, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x05, 0x01, 0x03,
+		0x02, 0x04, 0x01, 0x0B, 0x01, 0x09, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x06, 0x04, 0x07, 0x02,
+		0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x01,
+		0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x07, 0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01,
+		0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x08, 0x01,
+		0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x03, 0x01, 0x02,
+		0x03, 0x08, 0x00, 0x04, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x08, 0x00, 0x05, 0x01, 0x01, 0x05,
+		0x01, 0x05, 0x04, 0x02, 0x01, 0x05, 0x01, 0x05, 0x05, 0x07, 0x00, 0x05, 0x01, 0x01, 0x05, 0x01,
+		0x05, 0x04, 0x02, 0x01, 0x05, 0x01, 0x05, 0x01, 0x0B, 0x01, 0x04, 0x01, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x05, 0x01, 0x05, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x02, 0x04, 0x07, 0x00, 0x01,
+		0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x07, 0x00, 0x03, 0x02, 0x01, 0x03, 0x01, 0x03,
+		0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x03, 0x05, 0x02, 0x03, 0x04, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x05, 0x01, 0x02, 0x01, 0x02, 0x01, 0x03, 0x02, 0x09, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02,
+		0x01, 0x02, 0x01, 0x01, 0x01, 0x03, 0x02, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x02,
+		0x01, 0x03, 0x01, 0x07, 0x00, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x05, 0x05, 0x07, 0x00, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x03, 0x01, 0x07, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+		0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x07, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x00, 0x04,
+		0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x05, 0x01, 0x05, 0x01,
+		0x0B, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x02, 0x01, 0x01, 0x07, 0x00, 0x04,
+		0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x07, 0x01, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x06,
+		0x03, 0x06, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x00, 0x05, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x05, 0x01, 0x09, 0x00, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01,
+		0x04, 0x01, 0x09, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x02, 0x01, 0x01, 0x01, 0x08, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01,
+		0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x07, 0x00, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x05,
+		0x01, 0x05, 0x01, 0x05, 0x01, 0x09, 0x00, 0x05, 0x05, 0x01, 0x04, 0x01, 0x03, 0x03, 0x03, 0x01,
+		0x04, 0x01, 0x05, 0x05, 0x07, 0x00, 0x04, 0x01, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04,
+		0x01, 0x04, 0x04, 0x06, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x0D, 0x00,
+		0x04, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x01, 0x04, 0x06, 0x02, 0x01,
+		0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x1F, 0x24, 0x05, 0x07, 0x00, 0x02, 0x02, 0x02,
+		0x03, 0x01, 0x04, 0x01, 0x11, 0x0D, 0x02, 0x06, 0x01, 0x03, 0x03, 0x02, 0x01, 0x02, 0x01, 0x03,
+		0x04, 0x07, 0x00, 0x01, 0x05, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x03, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x08, 0x0D, 0x03, 0x02, 0x01, 0x03,
+		0x01, 0x01, 0x01, 0x05, 0x01, 0x03, 0x01, 0x02, 0x03, 0x08, 0x04, 0x01, 0x05, 0x01, 0x02, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x01, 0x01, 0x07, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x05, 0x01, 0x01, 0x06, 0x03, 0x08,
+		0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x03, 0x03, 0x01, 0x04, 0x01, 0x04, 0x01,
+		0x08, 0x0D, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x05,
+		0x01, 0x02, 0x03, 0x02, 0x00, 0x01, 0x05, 0x01, 0x05, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x07, 0x01, 0x01, 0x06,
+		0x02, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x03, 0x05, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01,
+		0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x07, 0x00, 0x01, 0x04, 0x01, 0x04, 0x01, 0x02,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x06,
+		0x00, 0x02, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x03, 0x01, 0x02, 0x03, 0x05, 0x0C,
+		0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x01, 0x02,
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x07, 0x0D, 0x03, 0x02, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02,
+		0x03, 0x08, 0x0C, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01,
+		0x01, 0x02, 0x02, 0x01, 0x05, 0x01, 0x05, 0x0D, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01,
+		0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x05, 0x01, 0x05, 0x01, 0x01, 0x0C, 0x01, 0x01, 0x02,
+		0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x05, 0x01, 0x05, 0x01, 0x0B, 0x0D, 0x04, 0x01, 0x01, 0x06,
+		0x03, 0x06, 0x01, 0x01, 0x04, 0x08, 0x02, 0x01, 0x05, 0x01, 0x03, 0x05, 0x03, 0x01, 0x05, 0x01,
+		0x05, 0x01, 0x01, 0x01, 0x04, 0x01, 0x08, 0x0C, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x03, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x07, 0x0C, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01, 0x04, 0x01, 0x09, 0x0C,
+		0x01, 0x03, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x08, 0x0C, 0x01, 0x03, 0x01, 0x02, 0x01, 0x01, 0x01,
+		0x04, 0x01, 0x04, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x07, 0x0C, 0x01, 0x03, 0x01, 0x01,
+		0x01, 0x03, 0x01, 0x02, 0x04, 0x05, 0x01, 0x01, 0x01, 0x03, 0x01, 0x02, 0x03, 0x02, 0x0C, 0x05,
+		0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x05, 0x07, 0x02, 0x01, 0x02, 0x01, 0x03, 0x01, 0x02,
+		0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x04, 0x01, 0x03, 0x01, 0x04, 0x01, 0x02, 0x01, 0x03,
+		0x01, 0x02, 0x01, 0x07, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x20,
+};
+
+static const st7735_glyph_t font_prop8_glyphs[] = {
+		{0, 3}, /* ' ' */
+		{1, 2}, /* '!' */
+		{14, 4}, /* '"' */
+		{27, 6}, /* '#' */
+		{52, 6}, /* '$' */
+		{71, 6}, /* '%' */
+		{90, 6}, /* '&' */
+		{117, 4}, /* ''' */
+		{126, 4}, /* '(' */
+		{141, 4}, /* ')' */
+		{156, 6}, /* '*' */
+		{179, 6}, /* '+' */
+		{190, 4}, /* ',' */
+		{199, 6}, /* '-' */
+		{202, 3}, /* '.' */
+		{207, 6}, /* '/' */
+		{218, 6}, /* '0' */
+		{245, 6}, /* '1' */
+		{260, 6}, /* '2' */
+		{277, 6}, /* '3' */
+		{294, 6}, /* '4' */
+		{313, 6}, /* '5' */
+		{330, 6}, /* '6' */
+		{349, 6}, /* '7' */
+		{364, 6}, /* '8' */
+		{387, 6}, /* '9' */
+		{406, 2}, /* ':' */
+		{411, 3}, /* ';' */
+		{420, 5}, /* '<' */
+		{435, 6}, /* '=' */
+		{440, 5}, /* '>' */
+		{455, 6}, /* '?' */
+		{470, 6}, /* '@' */
+		{495, 6}, /* 'A' */
+		{520, 6}, /* 'B' */
+		{543, 6}, /* 'C' */
+		{562, 6}, /* 'D' */
+		{587, 6}, /* 'E' */
+		{602, 6}, /* 'F' */
+		{617, 6}, /* 'G' */
+		{638, 6}, /* 'H' */
+		{665, 4}, /* 'I' */
+		{680, 6}, /* 'J' */
+		{697, 6}, /* 'K' */
+		{724, 6}, /* 'L' */
+		{739, 6}, /* 'M' */
+		{774, 6}, /* 'N' */
+		{805, 6}, /* 'O' */
+		{830, 6}, /* 'P' */
+		{849, 6}, /* 'Q' */
+		{878, 6}, /* 'R' */
+		{903, 6}, /* 'S' */
+		{922, 6}, /* 'T' */
+		{941, 6}, /* 'U' */
+		{968, 6}, /* 'V' */
+		{995, 6}, /* 'W' */
+		{1030, 6}, /* 'X' */
+		{1057, 6}, /* 'Y' */
+		{1078, 6}, /* 'Z' */
+		{1093, 5}, /* '[' */
+		{1108, 6}, /* '\\' */
+		{1119, 5}, /* ']' */
+		{1134, 6}, /* '^' */
+		{1145, 6}, /* '_' */
+		{1148, 4}, /* '`' */
+		{1157, 6}, /* 'a' */
+		{1170, 6}, /* 'b' */
+		{1195, 6}, /* 'c' */
+		{1210, 6}, /* 'd' */
+		{1235, 6}, /* 'e' */
+		{1248, 5}, /* 'f' */
+		{1265, 6}, /* 'g' */
+		{1284, 6}, /* 'h' */
+		{1309, 4}, /* 'i' */
+		{1322, 5}, /* 'j' */
+		{1337, 5}, /* 'k' */
+		{1360, 4}, /* 'l' */
+		{1375, 6}, /* 'm' */
+		{1404, 6}, /* 'n' */
+		{1425, 6}, /* 'o' */
+		{1442, 6}, /* 'p' */
+		{1463, 6}, /* 'q' */
+		{1484, 6}, /* 'r' */
+		{1499, 6}, /* 's' */
+		{1510, 6}, /* 't' */
+		{1527, 6}, /* 'u' */
+		{1548, 6}, /* 'v' */
+		{1567, 6}, /* 'w' */
+		{1592, 6}, /* 'x' */
+		{1611, 6}, /* 'y' */
+		{1630, 6}, /* 'z' */
+		{1641, 4}, /* '{' */
+		{1656, 2}, /* '|' */
+		{1669, 4}, /* '}' */
+		{1684, 6}, /* '~' */
+};
+
+const st7735_font_t font_prop8 = {
+		font_prop8_bitmap, font_prop8_glyphs, 0x20, 0x7E, 8};
+
+static const uint8_t font_prop16_bitmap[] = {
+		0x60, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x0A, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x52, 0x02, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x05,
+		0x03, 0x02, 0x03, 0x03, 0x0A, 0x02, 0x0A, 0x04, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x04,
+		0x0A, 0x02, 0x0A, 0x03, 0x03, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x1C, 0x04, 0x02, 0x09, 0x04, 0x07, 0x08, 0x03, 0x09, 0x02, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x07, 0x07, 0x06, 0x07, 0x07, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x02, 0x09, 0x03, 0x08, 0x07, 0x04, 0x09, 0x02, 0x1E, 0x01, 0x02, 0x09, 0x04, 0x08, 0x04, 0x04,
+		0x02, 0x03, 0x02, 0x04, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08,
+		0x03, 0x08, 0x03, 0x04, 0x02, 0x03, 0x02, 0x04, 0x04, 0x08, 0x04, 0x09, 0x02, 0x1B, 0x02, 0x02,
+		0x09, 0x04, 0x07, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x04, 0x03, 0x03, 0x02, 0x05, 0x05, 0x02, 0x02, 0x04, 0x04,
+		0x02, 0x02, 0x1A, 0x03, 0x02, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04,
+		0x03, 0x05, 0x02, 0x46, 0x04, 0x02, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x05, 0x02,
+		0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02,
+		0x12, 0x00, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06,
+		0x02, 0x06, 0x02, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x05, 0x02, 0x16, 0x04, 0x02,
+		0x0A, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+		0x07, 0x06, 0x04, 0x0A, 0x02, 0x0A, 0x04, 0x06, 0x07, 0x04, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x02, 0x1E, 0x1C, 0x02, 0x0A, 0x02, 0x0A,
+		0x02, 0x09, 0x04, 0x05, 0x0A, 0x02, 0x0A, 0x05, 0x04, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x36,
+		0x43, 0x02, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x05, 0x02,
+		0x06, 0x48, 0x0A, 0x02, 0x0A, 0x62, 0x3D, 0x02, 0x03, 0x04, 0x02, 0x04, 0x03, 0x02, 0x0F, 0x20,
+		0x02, 0x09, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08,
+		0x03, 0x09, 0x02, 0x3A, 0x02, 0x06, 0x05, 0x08, 0x03, 0x03, 0x05, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x05, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x04, 0x02, 0x09, 0x03, 0x08, 0x04, 0x08,
+		0x04, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x09,
+		0x04, 0x07, 0x06, 0x06, 0x06, 0x1C, 0x02, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02,
+		0x06, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x04, 0x07, 0x04, 0x07, 0x04, 0x03, 0x09, 0x02, 0x0A, 0x02,
+		0x0A, 0x03, 0x09, 0x0A, 0x03, 0x09, 0x1A, 0x00, 0x09, 0x03, 0x0A, 0x0A, 0x02, 0x0A, 0x02, 0x08,
+		0x03, 0x08, 0x03, 0x08, 0x04, 0x08, 0x03, 0x01, 0x01, 0x0A, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x06, 0x02, 0x09, 0x03, 0x08, 0x04,
+		0x07, 0x05, 0x06, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02,
+		0x03, 0x04, 0x03, 0x0A, 0x03, 0x09, 0x07, 0x04, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x1C, 0x01,
+		0x09, 0x02, 0x0A, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x08, 0x05, 0x08, 0x0A, 0x03, 0x0A, 0x02, 0x0A,
+		0x02, 0x0A, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C,
+		0x04, 0x06, 0x05, 0x07, 0x04, 0x03, 0x08, 0x03, 0x08, 0x02, 0x0A, 0x02, 0x0A, 0x08, 0x04, 0x09,
+		0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03,
+		0x03, 0x08, 0x05, 0x06, 0x1C, 0x00, 0x09, 0x03, 0x0A, 0x09, 0x03, 0x0A, 0x02, 0x0A, 0x02, 0x09,
+		0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x09,
+		0x02, 0x22, 0x02, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x04, 0x06, 0x06, 0x06, 0x04, 0x03, 0x04, 0x03, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x02,
+		0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x03, 0x04, 0x03, 0x03, 0x09, 0x04, 0x08, 0x0A, 0x02, 0x0A, 0x02, 0x08, 0x03, 0x08, 0x03, 0x04,
+		0x07, 0x05, 0x06, 0x1E, 0x10, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x1A, 0x1A, 0x02, 0x04,
+		0x02, 0x10, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x10, 0x06, 0x02,
+		0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x08, 0x02, 0x09, 0x03,
+		0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x16, 0x30, 0x0A, 0x02, 0x0A, 0x1A,
+		0x0A, 0x02, 0x0A, 0x4A, 0x00, 0x02, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03, 0x08, 0x03,
+		0x09, 0x02, 0x08, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x07, 0x02,
+		0x1C, 0x02, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x0A, 0x02, 0x09,
+		0x03, 0x07, 0x04, 0x07, 0x04, 0x08, 0x03, 0x09, 0x02, 0x22, 0x02, 0x0A, 0x02, 0x1E, 0x02, 0x06,
+		0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02,
+		0x02, 0x05, 0x03, 0x02, 0x03, 0x02, 0x05, 0x02, 0x0A, 0x03, 0x0A, 0x09, 0x04, 0x08, 0x1A, 0x04,
+		0x02, 0x09, 0x04, 0x07, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x0A, 0x02, 0x0A, 0x02,
+		0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A,
+		0x01, 0x07, 0x04, 0x09, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x03, 0x04, 0x03, 0x02, 0x08, 0x04, 0x08, 0x04, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x09, 0x04, 0x07, 0x1C, 0x02, 0x06, 0x05,
+		0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A,
+		0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05,
+		0x06, 0x1C, 0x01, 0x07, 0x04, 0x09, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x09,
+		0x04, 0x07, 0x1C, 0x01, 0x09, 0x02, 0x0A, 0x02, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x03, 0x09,
+		0x08, 0x04, 0x08, 0x04, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x0A, 0x03, 0x09, 0x1A,
+		0x01, 0x09, 0x02, 0x0A, 0x02, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x08, 0x04, 0x08,
+		0x04, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x22, 0x02, 0x07, 0x04,
+		0x09, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A,
+		0x02, 0x0A, 0x02, 0x04, 0x03, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x05,
+		0x02, 0x03, 0x09, 0x04, 0x07, 0x1B, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x02, 0x0A,
+		0x02, 0x0A, 0x02, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x00, 0x06, 0x02, 0x06, 0x03,
+		0x04, 0x05, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06,
+		0x02, 0x05, 0x04, 0x03, 0x06, 0x02, 0x06, 0x12, 0x04, 0x06, 0x06, 0x06, 0x07, 0x04, 0x09, 0x02,
+		0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x04, 0x02, 0x04, 0x02,
+		0x04, 0x03, 0x02, 0x03, 0x05, 0x06, 0x07, 0x04, 0x1E, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x05,
+		0x03, 0x02, 0x02, 0x04, 0x03, 0x03, 0x02, 0x03, 0x03, 0x04, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02,
+		0x02, 0x06, 0x04, 0x08, 0x04, 0x08, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x05, 0x02, 0x03,
+		0x03, 0x04, 0x02, 0x04, 0x03, 0x03, 0x02, 0x05, 0x03, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x00, 0x02,
+		0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02,
+		0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x03, 0x09, 0x0A, 0x03, 0x09, 0x1A, 0x00, 0x02, 0x06, 0x02, 0x02,
+		0x03, 0x04, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A,
+		0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x05, 0x02,
+		0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x03,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x02, 0x06, 0x05,
+		0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x01, 0x07,
+		0x04, 0x09, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03,
+		0x04, 0x03, 0x02, 0x09, 0x03, 0x08, 0x04, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02,
+		0x0A, 0x02, 0x22, 0x02, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x04,
+		0x03, 0x03, 0x02, 0x05, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x1A, 0x01, 0x07, 0x04, 0x09,
+		0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03,
+		0x02, 0x09, 0x03, 0x08, 0x04, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x03, 0x03,
+		0x04, 0x02, 0x04, 0x03, 0x03, 0x02, 0x05, 0x03, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x02, 0x06, 0x05,
+		0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x0A, 0x03, 0x0A, 0x07, 0x06,
+		0x07, 0x0A, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05,
+		0x06, 0x1C, 0x01, 0x08, 0x03, 0x0A, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02,
+		0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x1E, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x00, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x07, 0x04, 0x09, 0x02,
+		0x1E, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02,
+		0x03, 0x05, 0x02, 0x02, 0x02, 0x1C, 0x00, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x08, 0x02,
+		0x0A, 0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x00, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05,
+		0x02, 0x02, 0x02, 0x07, 0x04, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A,
+		0x02, 0x0A, 0x02, 0x1E, 0x00, 0x09, 0x03, 0x0A, 0x0A, 0x02, 0x0A, 0x02, 0x08, 0x03, 0x08, 0x03,
+		0x07, 0x05, 0x06, 0x05, 0x07, 0x03, 0x08, 0x03, 0x08, 0x02, 0x0A, 0x02, 0x0A, 0x0A, 0x03, 0x09,
+		0x1A, 0x01, 0x07, 0x02, 0x08, 0x02, 0x03, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08,
+		0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x03, 0x07, 0x08, 0x03, 0x07, 0x16, 0x18, 0x02,
+		0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03, 0x0A, 0x03,
+		0x0A, 0x02, 0x32, 0x00, 0x07, 0x03, 0x08, 0x07, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08,
+		0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x07, 0x03, 0x02, 0x08, 0x02, 0x07, 0x17,
+		0x04, 0x02, 0x09, 0x04, 0x07, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03,
+		0x02, 0x02, 0x06, 0x02, 0x7A, 0x90, 0x0A, 0x02, 0x0A, 0x1A, 0x01, 0x02, 0x05, 0x04, 0x04, 0x04,
+		0x05, 0x03, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x42, 0x32, 0x04, 0x08, 0x05, 0x0B,
+		0x02, 0x0A, 0x02, 0x06, 0x06, 0x05, 0x07, 0x04, 0x02, 0x04, 0x02, 0x04, 0x02, 0x04, 0x03, 0x04,
+		0x09, 0x04, 0x08, 0x1A, 0x00, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x02, 0x04,
+		0x04, 0x02, 0x02, 0x05, 0x03, 0x05, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x02, 0x03, 0x02, 0x02, 0x02, 0x05,
+		0x03, 0x02, 0x02, 0x04, 0x1C, 0x32, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05,
+		0x06, 0x1C, 0x08, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03, 0x05,
+		0x02, 0x02, 0x02, 0x03, 0x02, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x02, 0x05, 0x03, 0x05, 0x02, 0x02, 0x04, 0x04,
+		0x02, 0x02, 0x1A, 0x32, 0x06, 0x05, 0x08, 0x03, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x0A, 0x02, 0x09, 0x03, 0x02, 0x0A, 0x02, 0x0B, 0x07, 0x06, 0x06, 0x1C, 0x04, 0x02, 0x07, 0x04,
+		0x05, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x04, 0x02, 0x07, 0x04, 0x05, 0x06, 0x04, 0x06,
+		0x05, 0x04, 0x07, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x1A, 0x32, 0x05, 0x06,
+		0x08, 0x03, 0x03, 0x02, 0x04, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x02,
+		0x01, 0x01, 0x03, 0x03, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x0A, 0x02, 0x09, 0x03, 0x04,
+		0x07, 0x05, 0x06, 0x04, 0x00, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x02, 0x04,
+		0x04, 0x02, 0x02, 0x05, 0x03, 0x05, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03, 0x05, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02,
+		0x02, 0x02, 0x06, 0x02, 0x1A, 0x02, 0x02, 0x06, 0x02, 0x14, 0x03, 0x05, 0x04, 0x05, 0x03, 0x06,
+		0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x04, 0x03, 0x06, 0x02, 0x06, 0x12, 0x06, 0x02,
+		0x08, 0x02, 0x1C, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x02, 0x02,
+		0x04, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x06, 0x05, 0x04, 0x18, 0x00, 0x02, 0x08, 0x02, 0x08,
+		0x02, 0x08, 0x02, 0x08, 0x02, 0x04, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03,
+		0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x04, 0x06, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x03, 0x03,
+		0x02, 0x03, 0x03, 0x02, 0x02, 0x04, 0x02, 0x16, 0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x06, 0x02,
+		0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x06, 0x02, 0x05, 0x04,
+		0x03, 0x06, 0x02, 0x06, 0x12, 0x31, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x03, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1A, 0x30, 0x02,
+		0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x03, 0x05, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03,
+		0x05, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x32, 0x06, 0x05, 0x08, 0x03, 0x03, 0x04, 0x03, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x1C, 0x30, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x05,
+		0x03, 0x03, 0x01, 0x01, 0x02, 0x03, 0x02, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03,
+		0x01, 0x01, 0x02, 0x03, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x0A, 0x02,
+		0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x32, 0x04, 0x02, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x03, 0x02,
+		0x01, 0x01, 0x03, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x02, 0x03, 0x02, 0x01, 0x01,
+		0x03, 0x03, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A,
+		0x02, 0x02, 0x30, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x05, 0x03, 0x05, 0x02, 0x03, 0x02, 0x04,
+		0x04, 0x02, 0x02, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x22, 0x32,
+		0x08, 0x03, 0x09, 0x02, 0x02, 0x0A, 0x02, 0x0B, 0x07, 0x06, 0x07, 0x0B, 0x02, 0x0A, 0x02, 0x02,
+		0x09, 0x03, 0x08, 0x1C, 0x04, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x09, 0x04, 0x05, 0x0A, 0x02, 0x0A,
+		0x05, 0x04, 0x09, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x07, 0x04, 0x09, 0x02, 0x1C, 0x30, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x02, 0x04,
+		0x04, 0x02, 0x03, 0x02, 0x05, 0x03, 0x05, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x1A, 0x30, 0x02,
+		0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02,
+		0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03, 0x05, 0x02, 0x02, 0x02, 0x07, 0x04,
+		0x09, 0x02, 0x1E, 0x30, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06, 0x02, 0x02,
+		0x02, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x05,
+		0x02, 0x02, 0x02, 0x1C, 0x30, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x03, 0x02, 0x03,
+		0x05, 0x02, 0x02, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x02, 0x02, 0x05, 0x03, 0x02, 0x03,
+		0x03, 0x03, 0x04, 0x03, 0x02, 0x02, 0x06, 0x02, 0x1A, 0x30, 0x02, 0x06, 0x02, 0x02, 0x02, 0x06,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x09, 0x04, 0x08, 0x09, 0x03, 0x0A,
+		0x02, 0x02, 0x02, 0x06, 0x02, 0x02, 0x03, 0x04, 0x03, 0x03, 0x08, 0x05, 0x06, 0x04, 0x30, 0x0A,
+		0x02, 0x0A, 0x08, 0x03, 0x09, 0x02, 0x08, 0x03, 0x08, 0x03, 0x08, 0x02, 0x09, 0x03, 0x08, 0x0A,
+		0x02, 0x0A, 0x1A, 0x04, 0x02, 0x05, 0x03, 0x04, 0x03, 0x05, 0x02, 0x06, 0x02, 0x05, 0x03, 0x04,
+		0x02, 0x06, 0x02, 0x07, 0x03, 0x06, 0x02, 0x06, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06, 0x02, 0x12,
+		0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x00, 0x02, 0x06, 0x03, 0x06, 0x03, 0x06,
+		0x02, 0x06, 0x02, 0x06, 0x03, 0x07, 0x02, 0x06, 0x02, 0x04, 0x03, 0x05, 0x02, 0x06, 0x02, 0x05,
+		0x03, 0x04, 0x03, 0x05, 0x02, 0x16, 0x02, 0x02, 0x09, 0x04, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x07, 0x04, 0x09, 0x02, 0x7C,
+};
+
+static const st7735_glyph_t font_prop16_glyphs[] = {
+		{0, 6}, /* ' ' */
+		{1, 4}, /* '!' */
+		{26, 8}, /* '"' */
+		{51, 12}, /* '#' */
+		{100, 12}, /* '$' */
+		{137, 12}, /* '%' */
+		{174, 12}, /* '&' */
+		{227, 8}, /* ''' */
+		{244, 8}, /* '(' */
+		{273, 8}, /* ')' */
+		{302, 12}, /* '*' */
+		{347, 12}, /* '+' */
+		{368, 8}, /* ',' */
+		{385, 12}, /* '-' */
+		{390, 6}, /* '.' */
+		{399, 12}, /* '/' */
+		{420, 12}, /* '0' */
+		{473, 12}, /* '1' */
+		{502, 12}, /* '2' */
+		{535, 12}, /* '3' */
+		{570, 12}, /* '4' */
+		{607, 12}, /* '5' */
+		{640, 12}, /* '6' */
+		{677, 12}, /* '7' */
+		{706, 12}, /* '8' */
+		{751, 12}, /* '9' */
+		{788, 4}, /* ':' */
+		{797, 6}, /* ';' */
+		{814, 10}, /* '<' */
+		{843, 12}, /* '=' */
+		{852, 10}, /* '>' */
+		{881, 12}, /* '?' */
+		{910, 12}, /* '@' */
+		{959, 12}, /* 'A' */
+		{1008, 12}, /* 'B' */
+		{1053, 12}, /* 'C' */
+		{1090, 12}, /* 'D' */
+		{1139, 12}, /* 'E' */
+		{1168, 12}, /* 'F' */
+		{1197, 12}, /* 'G' */
+		{1238, 12}, /* 'H' */
+		{1291, 8}, /* 'I' */
+		{1320, 12}, /* 'J' */
+		{1353, 12}, /* 'K' */
+		{1406, 12}, /* 'L' */
+		{1435, 12}, /* 'M' */
+		{1504, 12}, /* 'N' */
+		{1565, 12}, /* 'O' */
+		{1614, 12}, /* 'P' */
+		{1651, 12}, /* 'Q' */
+		{1708, 12}, /* 'R' */
+		{1757, 12}, /* 'S' */
+		{1794, 12}, /* 'T' */
+		{1831, 12}, /* 'U' */
+		{1884, 12}, /* 'V' */
+		{1937, 12}, /* 'W' */
+		{2006, 12}, /* 'X' */
+		{2059, 12}, /* 'Y' */
+		{2100, 12}, /* 'Z' */
+		{2129, 10}, /* '[' */
+		{2158, 12}, /* '\\' */
+		{2179, 10}, /* ']' */
+		{2208, 12}, /* '^' */
+		{2229, 12}, /* '_' */
+		{2234, 8}, /* '`' */
+		{2251, 12}, /* 'a' */
+		{2276, 12}, /* 'b' */
+		{2325, 12}, /* 'c' */
+		{2354, 12}, /* 'd' */
+		{2403, 12}, /* 'e' */
+		{2428, 10}, /* 'f' */
+		{2461, 12}, /* 'g' */
+		{2500, 12}, /* 'h' */
+		{2549, 8}, /* 'i' */
+		{2574, 10}, /* 'j' */
+		{2603, 10}, /* 'k' */
+		{2648, 8}, /* 'l' */
+		{2677, 12}, /* 'm' */
+		{2734, 12}, /* 'n' */
+		{2775, 12}, /* 'o' */
+		{2808, 12}, /* 'p' */
+		{2853, 12}, /* 'q' */
+		{2898, 12}, /* 'r' */
+		{2927, 12}, /* 's' */
+		{2948, 12}, /* 't' */
+		{2981, 12}, /* 'u' */
+		{3022, 12}, /* 'v' */
+		{3059, 12}, /* 'w' */
+		{3108, 12}, /* 'x' */
+		{3145, 12}, /* 'y' */
+		{3182, 12}, /* 'z' */
+		{3203, 8}, /* '{' */
+		{3232, 4}, /* '|' */
+		{3257, 8}, /* '}' */
+		{3286, 12}, /* '~' */
+};
+
+const st7735_font_t font_prop16 = {
+		font_prop16_bitmap, font_prop16_glyphs, 0x20, 0x7E, 16};
+
+static const uint8_t font_prop24_bitmap[] = {
+		0xD8, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x15,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xB7, 0x03, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x04, 0x07,
+		0x04, 0x03, 0x04, 0x05, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x06, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x05, 0x04, 0x03, 0x04, 0x07,
+		0x04, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x3C, 0x06, 0x03, 0x0F, 0x03, 0x0E, 0x06, 0x0A, 0x0C, 0x06, 0x0C, 0x05, 0x0D,
+		0x03, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0B, 0x0A, 0x09, 0x09,
+		0x09, 0x0A, 0x0B, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x0D,
+		0x05, 0x0C, 0x06, 0x0C, 0x0A, 0x06, 0x0E, 0x03, 0x0F, 0x03, 0x3F, 0x02, 0x02, 0x0F, 0x04, 0x0D,
+		0x06, 0x0C, 0x06, 0x06, 0x03, 0x04, 0x04, 0x07, 0x03, 0x05, 0x02, 0x07, 0x04, 0x0C, 0x04, 0x0E,
+		0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C,
+		0x04, 0x07, 0x02, 0x05, 0x03, 0x07, 0x04, 0x04, 0x03, 0x06, 0x06, 0x0C, 0x06, 0x0D, 0x04, 0x0F,
+		0x02, 0x3B, 0x03, 0x03, 0x0F, 0x03, 0x0E, 0x05, 0x0B, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x0C, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x03,
+		0x06, 0x05, 0x04, 0x03, 0x08, 0x07, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03,
+		0x39, 0x05, 0x02, 0x09, 0x04, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x04, 0x07,
+		0x04, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x09, 0x03, 0x99, 0x06, 0x03, 0x09, 0x03, 0x08, 0x04,
+		0x06, 0x04, 0x08, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08, 0x04, 0x08, 0x03, 0x09, 0x03, 0x09, 0x03,
+		0x09, 0x03, 0x09, 0x03, 0x09, 0x04, 0x08, 0x04, 0x0A, 0x04, 0x09, 0x03, 0x09, 0x04, 0x0A, 0x04,
+		0x09, 0x03, 0x09, 0x03, 0x27, 0x00, 0x03, 0x09, 0x03, 0x09, 0x04, 0x0A, 0x04, 0x09, 0x03, 0x09,
+		0x04, 0x0A, 0x04, 0x08, 0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x08,
+		0x04, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x09, 0x03, 0x2D,
+		0x06, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x0A, 0x09, 0x09, 0x09, 0x06, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x06, 0x09, 0x09, 0x09, 0x0A, 0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x3F, 0x3C, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x05, 0x0C, 0x07, 0x07,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x07, 0x07, 0x0C, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x75, 0x95, 0x02, 0x09, 0x04, 0x07, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x05, 0x07, 0x04,
+		0x07, 0x04, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x09, 0x03, 0x09, 0xA2, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0xDB, 0x89, 0x02, 0x06, 0x04, 0x04, 0x06, 0x03, 0x06, 0x04, 0x04, 0x06, 0x02, 0x20, 0x42,
+		0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E,
+		0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x7B, 0x03, 0x09,
+		0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x07, 0x03, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07,
+		0x05, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x08, 0x04, 0x03, 0x03, 0x07, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x06, 0x03, 0x0F,
+		0x03, 0x0E, 0x04, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0E, 0x04, 0x0E, 0x04, 0x0F, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x05, 0x0D,
+		0x05, 0x0B, 0x09, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05,
+		0x05, 0x05, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0D, 0x05,
+		0x06, 0x0A, 0x08, 0x09, 0x08, 0x0A, 0x06, 0x05, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x04,
+		0x0E, 0x05, 0x0D, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x39, 0x00, 0x0D, 0x05, 0x0E, 0x04, 0x0F, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0C, 0x04, 0x0E, 0x04, 0x0D, 0x04, 0x0C, 0x06, 0x0C, 0x05, 0x01,
+		0x01, 0x0B, 0x04, 0x02, 0x01, 0x0F, 0x05, 0x0E, 0x04, 0x0F, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x08, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x09, 0x03,
+		0x0F, 0x03, 0x0E, 0x04, 0x0C, 0x06, 0x0C, 0x06, 0x0B, 0x07, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x05, 0x05, 0x03,
+		0x04, 0x06, 0x05, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x0A, 0x06, 0x0D, 0x05, 0x0E, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x3C, 0x02, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x0F, 0x0C, 0x07, 0x0B, 0x08, 0x0B, 0x0F, 0x05, 0x0E, 0x04, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05,
+		0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x06, 0x09, 0x09, 0x09, 0x08, 0x0A, 0x06, 0x05, 0x0D, 0x03,
+		0x0E, 0x04, 0x0C, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x0C, 0x06, 0x0C, 0x06, 0x0D, 0x05, 0x05,
+		0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04,
+		0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x00, 0x0D, 0x05,
+		0x0E, 0x04, 0x0F, 0x0D, 0x05, 0x0E, 0x04, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0E, 0x04, 0x0C,
+		0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0E,
+		0x04, 0x0C, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x45, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05,
+		0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04,
+		0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x05, 0x05, 0x05,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04,
+		0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x03, 0x09, 0x09, 0x09, 0x08,
+		0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0D, 0x06, 0x0C, 0x06, 0x0C, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0C, 0x04, 0x0E, 0x03, 0x0D, 0x05, 0x06, 0x0A, 0x08, 0x09, 0x09,
+		0x09, 0x3F, 0x24, 0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x03, 0x03, 0x03, 0x03, 0x03, 0x39, 0x39,
+		0x03, 0x06, 0x03, 0x06, 0x03, 0x21, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x05,
+		0x04, 0x03, 0x04, 0x05, 0x03, 0x06, 0x03, 0x21, 0x09, 0x03, 0x0C, 0x03, 0x0B, 0x04, 0x09, 0x04,
+		0x0B, 0x03, 0x0B, 0x04, 0x09, 0x04, 0x0B, 0x03, 0x0B, 0x04, 0x09, 0x03, 0x0C, 0x03, 0x0C, 0x03,
+		0x0E, 0x04, 0x0C, 0x03, 0x0C, 0x04, 0x0D, 0x04, 0x0C, 0x03, 0x0C, 0x04, 0x0D, 0x04, 0x0C, 0x03,
+		0x0C, 0x03, 0x30, 0x6C, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x39, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0xA5,
+		0x00, 0x03, 0x0C, 0x03, 0x0C, 0x04, 0x0D, 0x04, 0x0C, 0x03, 0x0C, 0x04, 0x0D, 0x04, 0x0C, 0x03,
+		0x0C, 0x04, 0x0E, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x09, 0x04, 0x0B, 0x03, 0x0B, 0x04, 0x09, 0x04,
+		0x0B, 0x03, 0x0B, 0x04, 0x09, 0x04, 0x0B, 0x03, 0x0C, 0x03, 0x39, 0x03, 0x09, 0x09, 0x09, 0x08,
+		0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x0E,
+		0x04, 0x0D, 0x05, 0x0B, 0x05, 0x0C, 0x05, 0x0C, 0x06, 0x0C, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x45,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x3F, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x08, 0x04, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x07, 0x05, 0x03, 0x04, 0x05, 0x06, 0x03,
+		0x05, 0x02, 0x08, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0F, 0x0D, 0x06, 0x0C, 0x06, 0x0C, 0x39, 0x06,
+		0x03, 0x0F, 0x03, 0x0E, 0x05, 0x0B, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03,
+		0x04, 0x05, 0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x39, 0x02, 0x0A, 0x07, 0x0B, 0x06, 0x0D, 0x05, 0x05,
+		0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04,
+		0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x03, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x05, 0x05, 0x05,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04,
+		0x03, 0x05, 0x05, 0x05, 0x03, 0x0D, 0x06, 0x0B, 0x08, 0x0A, 0x3C, 0x03, 0x09, 0x09, 0x09, 0x08,
+		0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x09, 0x03, 0x03, 0x04, 0x08, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09,
+		0x09, 0x3C, 0x02, 0x0A, 0x07, 0x0B, 0x06, 0x0D, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04,
+		0x03, 0x05, 0x05, 0x05, 0x03, 0x0D, 0x06, 0x0B, 0x08, 0x0A, 0x3C, 0x02, 0x0D, 0x04, 0x0E, 0x03,
+		0x0F, 0x03, 0x05, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x0C, 0x06,
+		0x0C, 0x06, 0x0C, 0x06, 0x05, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0D,
+		0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x39, 0x02, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x05, 0x0D, 0x04,
+		0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x05,
+		0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x45, 0x03, 0x0A, 0x08, 0x0B, 0x06, 0x0D, 0x03, 0x05, 0x05, 0x05, 0x03, 0x04, 0x08, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x06, 0x04, 0x05, 0x03, 0x06, 0x05, 0x04, 0x03, 0x06, 0x06, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x04, 0x08, 0x03, 0x03, 0x05, 0x07, 0x03, 0x05, 0x0D, 0x06, 0x0B, 0x07, 0x0A, 0x3B, 0x00, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05,
+		0x05, 0x05, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x39, 0x00, 0x09, 0x03,
+		0x09, 0x03, 0x09, 0x05, 0x05, 0x07, 0x05, 0x08, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09,
+		0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x08, 0x05, 0x07,
+		0x05, 0x05, 0x09, 0x03, 0x09, 0x03, 0x09, 0x27, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0B, 0x05,
+		0x0D, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05, 0x04, 0x06, 0x05,
+		0x02, 0x05, 0x08, 0x08, 0x0B, 0x06, 0x0C, 0x06, 0x3F, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x06, 0x04, 0x05, 0x03, 0x06, 0x03, 0x06, 0x03, 0x05,
+		0x04, 0x06, 0x03, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x06, 0x0C,
+		0x06, 0x0C, 0x06, 0x0C, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x08,
+		0x03, 0x05, 0x04, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x03, 0x08, 0x04, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x39, 0x00, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x0F, 0x04, 0x0E,
+		0x05, 0x0D, 0x39, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03,
+		0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x39, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x08, 0x03, 0x03, 0x04,
+		0x08, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x08, 0x04,
+		0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x39, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03,
+		0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x02, 0x0A,
+		0x07, 0x0B, 0x06, 0x0D, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x03, 0x0D, 0x05, 0x0C,
+		0x06, 0x0C, 0x06, 0x05, 0x0D, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x45, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03,
+		0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x03, 0x06, 0x05, 0x04, 0x03, 0x08, 0x07, 0x03,
+		0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x39, 0x02, 0x0A, 0x07, 0x0B, 0x06, 0x0D,
+		0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x03, 0x0D, 0x05, 0x0C, 0x06, 0x0C, 0x06, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x05, 0x04, 0x06, 0x03,
+		0x06, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05, 0x03, 0x08, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x39, 0x03, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x08,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0F, 0x04, 0x0E, 0x05, 0x0F, 0x0A, 0x09, 0x09, 0x09,
+		0x0A, 0x0F, 0x05, 0x0E, 0x04, 0x0F, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03,
+		0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x02, 0x0B, 0x06, 0x0D, 0x04, 0x0F,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x3F, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C,
+		0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x05, 0x04, 0x03, 0x04,
+		0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0B, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0x3F, 0x00,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x08, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x3C, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x05, 0x04,
+		0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0C, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0C, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x04, 0x05, 0x04, 0x07, 0x04,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x39, 0x00, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x05, 0x04, 0x03,
+		0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0B, 0x05, 0x0D, 0x05, 0x0E, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x3F, 0x00, 0x0D, 0x05, 0x0E, 0x04, 0x0F, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0C, 0x04,
+		0x0E, 0x04, 0x0C, 0x05, 0x0B, 0x07, 0x0A, 0x07, 0x0A, 0x07, 0x0B, 0x05, 0x0C, 0x04, 0x0E, 0x04,
+		0x0C, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x0F, 0x04, 0x0E, 0x05, 0x0D, 0x39, 0x02, 0x0A, 0x04,
+		0x0B, 0x03, 0x0C, 0x03, 0x05, 0x0A, 0x04, 0x0B, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
+		0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x04, 0x0B,
+		0x05, 0x0A, 0x0C, 0x04, 0x0B, 0x05, 0x0A, 0x30, 0x36, 0x03, 0x0F, 0x03, 0x0F, 0x04, 0x10, 0x04,
+		0x0F, 0x03, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x03, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x03, 0x0F, 0x04,
+		0x10, 0x04, 0x0F, 0x03, 0x0F, 0x03, 0x6F, 0x00, 0x0A, 0x05, 0x0B, 0x04, 0x0C, 0x0A, 0x05, 0x0B,
+		0x04, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,
+		0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0B, 0x04, 0x0A, 0x05, 0x03, 0x0C, 0x03, 0x0B, 0x04,
+		0x0A, 0x32, 0x06, 0x03, 0x0F, 0x03, 0x0E, 0x05, 0x0B, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x08, 0x04, 0x03, 0x04, 0x05, 0x04, 0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0xFF, 0x00, 0x12, 0xFF, 0x00, 0x45, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x39, 0x02, 0x02, 0x09, 0x04,
+		0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x07, 0x05, 0x08, 0x04, 0x09, 0x04, 0x08, 0x04, 0x0A, 0x04,
+		0x09, 0x03, 0x09, 0x03, 0x93, 0x6F, 0x06, 0x0C, 0x06, 0x0C, 0x07, 0x11, 0x03, 0x0F, 0x03, 0x0F,
+		0x03, 0x09, 0x09, 0x09, 0x09, 0x08, 0x0A, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x04, 0x05,
+		0x03, 0x06, 0x04, 0x07, 0x0D, 0x06, 0x0C, 0x06, 0x0C, 0x39, 0x00, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03,
+		0x03, 0x07, 0x05, 0x08, 0x02, 0x05, 0x03, 0x06, 0x05, 0x04, 0x03, 0x06, 0x06, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06,
+		0x05, 0x04, 0x03, 0x08, 0x02, 0x05, 0x03, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x06, 0x06, 0x03,
+		0x03, 0x06, 0x3C, 0x6F, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x08,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x09, 0x03, 0x03,
+		0x04, 0x08, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09, 0x09, 0x3C, 0x0C, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06,
+		0x03, 0x03, 0x05, 0x07, 0x03, 0x03, 0x03, 0x05, 0x02, 0x08, 0x03, 0x04, 0x05, 0x06, 0x03, 0x03,
+		0x06, 0x06, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x06, 0x06, 0x03, 0x04, 0x05, 0x06, 0x03, 0x05, 0x02, 0x08, 0x05, 0x07, 0x03, 0x03, 0x06, 0x06,
+		0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x39, 0x6F, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0D, 0x05,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x11, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x3C, 0x06, 0x03, 0x0C, 0x03,
+		0x0B, 0x05, 0x08, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x03,
+		0x0B, 0x05, 0x0A, 0x05, 0x08, 0x09, 0x06, 0x09, 0x06, 0x09, 0x08, 0x05, 0x0A, 0x05, 0x0B, 0x03,
+		0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x36, 0x6F, 0x07, 0x0B,
+		0x09, 0x08, 0x0B, 0x05, 0x05, 0x02, 0x07, 0x04, 0x04, 0x04, 0x06, 0x04, 0x03, 0x06, 0x06, 0x03,
+		0x03, 0x06, 0x06, 0x03, 0x04, 0x04, 0x01, 0x01, 0x05, 0x03, 0x05, 0x02, 0x02, 0x01, 0x05, 0x05,
+		0x07, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0D,
+		0x05, 0x06, 0x0A, 0x08, 0x09, 0x09, 0x09, 0x06, 0x00, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07,
+		0x05, 0x08, 0x02, 0x05, 0x03, 0x06, 0x05, 0x04, 0x03, 0x06, 0x06, 0x03, 0x03, 0x04, 0x08, 0x03,
+		0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x39, 0x03, 0x03, 0x09, 0x03, 0x09, 0x03, 0x2A, 0x04, 0x08, 0x05, 0x07, 0x06, 0x08, 0x04, 0x08,
+		0x04, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x08, 0x05, 0x07, 0x05, 0x05,
+		0x09, 0x03, 0x09, 0x03, 0x09, 0x27, 0x09, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x39, 0x03, 0x0C, 0x03,
+		0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x03, 0x03,
+		0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x05, 0x02, 0x05, 0x05, 0x08, 0x08, 0x06, 0x09, 0x06,
+		0x33, 0x00, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x06,
+		0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x03, 0x03, 0x04, 0x05, 0x03, 0x03,
+		0x03, 0x06, 0x03, 0x03, 0x03, 0x06, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x03, 0x03, 0x03, 0x06,
+		0x03, 0x03, 0x03, 0x06, 0x03, 0x03, 0x04, 0x05, 0x03, 0x05, 0x04, 0x03, 0x03, 0x06, 0x03, 0x03,
+		0x03, 0x06, 0x03, 0x30, 0x00, 0x04, 0x08, 0x05, 0x07, 0x06, 0x08, 0x04, 0x08, 0x04, 0x09, 0x03,
+		0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03, 0x09, 0x03,
+		0x09, 0x03, 0x09, 0x03, 0x08, 0x05, 0x07, 0x05, 0x05, 0x09, 0x03, 0x09, 0x03, 0x09, 0x27, 0x6E,
+		0x04, 0x03, 0x03, 0x07, 0x05, 0x03, 0x03, 0x06, 0x06, 0x03, 0x04, 0x05, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x39, 0x6C, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07,
+		0x05, 0x08, 0x02, 0x05, 0x03, 0x06, 0x05, 0x04, 0x03, 0x06, 0x06, 0x03, 0x03, 0x04, 0x08, 0x03,
+		0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x39, 0x6F, 0x09, 0x09, 0x09, 0x08, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x07, 0x04, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09,
+		0x09, 0x3C, 0x6C, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07, 0x05, 0x05,
+		0x01, 0x02, 0x02, 0x05, 0x03, 0x05, 0x01, 0x01, 0x04, 0x04, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06,
+		0x06, 0x03, 0x03, 0x05, 0x01, 0x01, 0x04, 0x04, 0x03, 0x05, 0x01, 0x02, 0x02, 0x05, 0x03, 0x03,
+		0x03, 0x07, 0x05, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x6F, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x05,
+		0x07, 0x03, 0x03, 0x03, 0x05, 0x02, 0x02, 0x01, 0x05, 0x03, 0x04, 0x04, 0x01, 0x01, 0x05, 0x03,
+		0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x04, 0x04, 0x01, 0x01, 0x05, 0x03, 0x05, 0x02,
+		0x02, 0x01, 0x05, 0x05, 0x07, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x03, 0x6C, 0x03, 0x03, 0x06,
+		0x06, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x07, 0x05, 0x08, 0x02, 0x05, 0x03, 0x06, 0x06, 0x03,
+		0x03, 0x06, 0x06, 0x03, 0x03, 0x04, 0x0E, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x45, 0x6F, 0x0C, 0x06, 0x0C, 0x05, 0x0D, 0x03, 0x03, 0x0F,
+		0x03, 0x0F, 0x03, 0x11, 0x0A, 0x09, 0x09, 0x09, 0x0A, 0x11, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x03,
+		0x0D, 0x05, 0x0C, 0x06, 0x0C, 0x3C, 0x06, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0E, 0x05,
+		0x0C, 0x07, 0x07, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x07, 0x07, 0x0C, 0x05, 0x0E, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03,
+		0x0B, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0x3C, 0x6C, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x06, 0x06, 0x03,
+		0x04, 0x05, 0x06, 0x03, 0x05, 0x02, 0x08, 0x05, 0x07, 0x03, 0x03, 0x06, 0x06, 0x03, 0x03, 0x06,
+		0x06, 0x03, 0x03, 0x39, 0x6C, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03,
+		0x03, 0x04, 0x07, 0x04, 0x03, 0x04, 0x07, 0x04, 0x05, 0x04, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03,
+		0x09, 0x03, 0x03, 0x03, 0x0B, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0x3F, 0x6C, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x04, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09,
+		0x03, 0x03, 0x03, 0x3C, 0x6C, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04,
+		0x05, 0x04, 0x03, 0x04, 0x08, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x0C, 0x03, 0x0F, 0x03,
+		0x0F, 0x03, 0x0C, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x04, 0x05, 0x04,
+		0x07, 0x04, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x39, 0x6C, 0x03, 0x09, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x03, 0x09, 0x03, 0x03, 0x04, 0x07, 0x04, 0x03,
+		0x05, 0x05, 0x05, 0x05, 0x0D, 0x06, 0x0C, 0x06, 0x0C, 0x0D, 0x05, 0x0E, 0x04, 0x0F, 0x03, 0x03,
+		0x03, 0x09, 0x03, 0x03, 0x03, 0x08, 0x04, 0x03, 0x05, 0x05, 0x05, 0x05, 0x0B, 0x08, 0x09, 0x09,
+		0x09, 0x06, 0x6C, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x0C, 0x04, 0x0E, 0x03, 0x0F, 0x03, 0x0C, 0x04,
+		0x0E, 0x03, 0x0E, 0x04, 0x0C, 0x03, 0x0F, 0x03, 0x0E, 0x04, 0x0C, 0x0F, 0x03, 0x0F, 0x03, 0x0F,
+		0x39, 0x06, 0x03, 0x09, 0x03, 0x08, 0x04, 0x06, 0x04, 0x08, 0x04, 0x08, 0x03, 0x09, 0x03, 0x08,
+		0x04, 0x08, 0x04, 0x06, 0x03, 0x09, 0x03, 0x09, 0x03, 0x0B, 0x04, 0x08, 0x04, 0x09, 0x03, 0x09,
+		0x03, 0x09, 0x04, 0x08, 0x04, 0x0A, 0x04, 0x09, 0x03, 0x09, 0x03, 0x27, 0x00, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x15, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x15, 0x00, 0x03, 0x09, 0x03, 0x09, 0x04, 0x0A, 0x04, 0x08, 0x04, 0x09, 0x03, 0x09, 0x03, 0x09,
+		0x04, 0x08, 0x04, 0x0B, 0x03, 0x09, 0x03, 0x09, 0x03, 0x06, 0x04, 0x08, 0x04, 0x08, 0x03, 0x09,
+		0x03, 0x08, 0x04, 0x08, 0x04, 0x06, 0x04, 0x08, 0x03, 0x09, 0x03, 0x2D, 0x03, 0x03, 0x0F, 0x03,
+		0x0E, 0x05, 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		0x03, 0x03, 0x03, 0x03, 0x0B, 0x05, 0x0E, 0x03, 0x0F, 0x03, 0xFF, 0x00, 0x15,
+};
+
+static const st7735_glyph_t font_prop24_glyphs[] = {
+		{0, 9}, /* ' ' */
+		{1, 6}, /* '!' */
+		{38, 12}, /* '"' */
+		{75, 18}, /* '#' */
+		{148, 18}, /* '$' */
+		{203, 18}, /* '%' */
+		{258, 18}, /* '&' */
+		{337, 12}, /* ''' */
+		{362, 12}, /* '(' */
+		{405, 12}, /* ')' */
+		{448, 18}, /* '*' */
+		{515, 18}, /* '+' */
+		{546, 12}, /* ',' */
+		{571, 18}, /* '-' */
+		{578, 9}, /* '.' */
+		{591, 18}, /* '/' */
+		{622, 18}, /* '0' */
+		{701, 18}, /* '1' */
+		{744, 18}, /* '2' */
+		{793, 18}, /* '3' */
+		{846, 18}, /* '4' */
+		{901, 18}, /* '5' */
+		{950, 18}, /* '6' */
+		{1005, 18}, /* '7' */
+		{1048, 18}, /* '8' */
+		{1115, 18}, /* '9' */
+		{1170, 6}, /* ':' */
+		{1183, 9}, /* ';' */
+		{1208, 15}, /* '<' */
+		{1251, 18}, /* '=' */
+		{1264, 15}, /* '>' */
+		{1307, 18}, /* '?' */
+		{1350, 18}, /* '@' */
+		{1423, 18}, /* 'A' */
+		{1496, 18}, /* 'B' */
+		{1563, 18}, /* 'C' */
+		{1618, 18}, /* 'D' */
+		{1691, 18}, /* 'E' */
+		{1734, 18}, /* 'F' */
+		{1777, 18}, /* 'G' */
+		{1838, 18}, /* 'H' */
+		{1917, 12}, /* 'I' */
+		{1960, 18}, /* 'J' */
+		{2009, 18}, /* 'K' */
+		{2088, 18}, /* 'L' */
+		{2131, 18}, /* 'M' */
+		{2234, 18}, /* 'N' */
+		{2325, 18}, /* 'O' */
+		{2398, 18}, /* 'P' */
+		{2453, 18}, /* 'Q' */
+		{2538, 18}, /* 'R' */
+		{2611, 18}, /* 'S' */
+		{2666, 18}, /* 'T' */
+		{2721, 18}, /* 'U' */
+		{2800, 18}, /* 'V' */
+		{2879, 18}, /* 'W' */
+		{2982, 18}, /* 'X' */
+		{3061, 18}, /* 'Y' */
+		{3122, 18}, /* 'Z' */
+		{3165, 15}, /* '[' */
+		{3208, 18}, /* '\\' */
+		{3239, 15}, /* ']' */
+		{3282, 18}, /* '^' */
+		{3315, 18}, /* '_' */
+		{3324, 12}, /* '`' */
+		{3349, 18}, /* 'a' */
+		{3386, 18}, /* 'b' */
+		{3459, 18}, /* 'c' */
+		{3502, 18}, /* 'd' */
+		{3575, 18}, /* 'e' */
+		{3612, 15}, /* 'f' */
+		{3661, 18}, /* 'g' */
+		{3720, 18}, /* 'h' */
+		{3793, 12}, /* 'i' */
+		{3830, 15}, /* 'j' */
+		{3873, 15}, /* 'k' */
+		{3940, 12}, /* 'l' */
+		{3983, 18}, /* 'm' */
+		{4068, 18}, /* 'n' */
+		{4129, 18}, /* 'o' */
+		{4178, 18}, /* 'p' */
+		{4247, 18}, /* 'q' */
+		{4316, 18}, /* 'r' */
+		{4359, 18}, /* 's' */
+		{4390, 18}, /* 't' */
+		{4439, 18}, /* 'u' */
+		{4500, 18}, /* 'v' */
+		{4555, 18}, /* 'w' */
+		{4628, 18}, /* 'x' */
+		{4683, 18}, /* 'y' */
+		{4738, 18}, /* 'z' */
+		{4769, 12}, /* '{' */
+		{4812, 6}, /* '|' */
+		{4849, 12}, /* '}' */
+		{4892, 18}, /* '~' */
+};
+
+const st7735_font_t font_prop24 = {
+		font_prop24_bitmap, font_prop24_glyphs, 0x20, 0x7E, 24};
@@ -0,0 +1,30 @@
+/**
+ * Images for the ST7735 image blitter
+ * Generated by Tools/img2rle.py, do not edit.
+ */
+
+#include "ST7735_ICONS.h"
+
+static const uint8_t icon_comfort_good_data[] = {
+		0x03, 0x06, 0x05, 0x01, 0x06, 0x01, 0x03, 0x01, 0x08, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x01, 0x01, 0x06, 0x01,
+		0x01, 0x02, 0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x04, 0x02, 0x01, 0x03, 0x01,
+		0x06, 0x01, 0x05, 0x06, 0x03,
+};
+
+const st7735_image_t icon_comfort_good = {12, 12, ST7735_IMAGE_RLE1, icon_comfort_good_data};
+
+static const uint8_t icon_comfort_bad_data[] = {
+		0x03, 0x06, 0x05, 0x01, 0x06, 0x01, 0x03, 0x01, 0x08, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x02, 0x0A, 0x02, 0x03, 0x04, 0x03, 0x02,
+		0x02, 0x01, 0x04, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01,
+		0x06, 0x01, 0x05, 0x06, 0x03,
+};
+
+const st7735_image_t icon_comfort_bad = {12, 12, ST7735_IMAGE_RLE1, icon_comfort_bad_data};
+
+static const uint8_t icon_co2_data[] = {
+		0x1D, 0x03, 0x08, 0x05, 0x05, 0x01, 0x01, 0x06, 0x03, 0x23, 0x01, 0x0A, 0x25,
+};
+
+const st7735_image_t icon_co2 = {12, 12, ST7735_IMAGE_RLE1, icon_co2_data};
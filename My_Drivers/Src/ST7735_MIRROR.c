@@ -0,0 +1,212 @@
+/**
+ * TFT display mirroring stream realisation
+ */
+
+#include "ST7735_MIRROR.h"
+#include "cmsis_os.h"
+
+/* Runs shorter than this are cheaper as single pixels */
+#define ST7735_MIRROR_MIN_RUN 3
+
+/* Set while the display traffic is encoded */
+static volatile bool active;
+
+/* Ring of whole packets, written by the drawing task and read by the streaming one */
+static uint8_t ring[ST7735_MIRROR_BUF_SIZE];
+static volatile uint16_t ring_head, ring_tail;
+
+/* Payload of the packet being built */
+static uint8_t packet[ST7735_MIRROR_PAYLOAD_MAX];
+static uint16_t packet_len;
+
+/* Position of the count byte of the open pixels operation in packet, -1 when none is open */
+static int16_t pixels_op = -1;
+
+/* Run of equal pixels not encoded yet */
+static uint16_t run_color;
+static uint32_t run_len;
+
+/**
+ * @brief Returns the free space of the ring in bytes.
+ */
+static uint16_t ST7735_mirror_free(void) {
+	uint16_t used = (ring_head + ST7735_MIRROR_BUF_SIZE - ring_tail) % ST7735_MIRROR_BUF_SIZE;
+	return ST7735_MIRROR_BUF_SIZE - 1 - used;
+}
+
+/**
+ * @brief Queues the packet being built for reading.
+ * @details Waits for free space while the reader drains the ring. The packet is dropped when
+ * mirroring stops meanwhile or before the kernel runs, when nobody could read the ring.
+ */
+static void ST7735_mirror_commit(void) {
+	uint16_t size = packet_len + 3;
+	uint8_t check = 0;
+
+	pixels_op = -1;
+	if (packet_len == 0)
+		return;
+	while (ST7735_mirror_free() < size) {
+		if (!active || (osKernelGetState() != osKernelRunning)) {
+			packet_len = 0;
+			return;
+		}
+		osDelay(1);
+	}
+
+	/* The head moves past the packet only once all of it is stored */
+	uint16_t head = ring_head;
+	ring[head] = ST7735_MIRROR_SYNC;
+	head = (head + 1) % ST7735_MIRROR_BUF_SIZE;
+	ring[head] = packet_len;
+	head = (head + 1) % ST7735_MIRROR_BUF_SIZE;
+	for (uint16_t i = 0; i < packet_len; i++) {
+		ring[head] = packet[i];
+		head = (head + 1) % ST7735_MIRROR_BUF_SIZE;
+		check ^= packet[i];
+	}
+	ring[head] = check;
+	ring_head = (head + 1) % ST7735_MIRROR_BUF_SIZE;
+	packet_len = 0;
+}
+
+/**
+ * @brief Makes room for bytes in the packet being built.
+ * @param size Number of bytes needed, at most ST7735_MIRROR_PAYLOAD_MAX.
+ */
+static void ST7735_mirror_reserve(uint16_t size) {
+	if (packet_len + size > ST7735_MIRROR_PAYLOAD_MAX)
+		ST7735_mirror_commit();
+}
+
+/**
+ * @brief Appends a single pixel, to the open pixels operation when there is one.
+ * @param color The RGB565 color.
+ */
+static void ST7735_mirror_pixel(uint16_t color) {
+	if ((pixels_op < 0) || (packet[pixels_op] == 0xFF) ||
+			(packet_len + 2 > ST7735_MIRROR_PAYLOAD_MAX)) {
+		ST7735_mirror_reserve(4);
+		packet[packet_len++] = ST7735_MIRROR_OP_PIXELS;
+		pixels_op = packet_len;
+		packet[packet_len++] = 0;
+	}
+	packet[packet_len++] = color >> 8;
+	packet[packet_len++] = color;
+	packet[pixels_op]++;
+}
+
+/**
+ * @brief Encodes the pending run of equal pixels.
+ */
+static void ST7735_mirror_flush_run(void) {
+	if (run_len < ST7735_MIRROR_MIN_RUN) {
+		while (run_len) {
+			ST7735_mirror_pixel(run_color);
+			run_len--;
+		}
+		return;
+	}
+	while (run_len) {
+		uint16_t n = run_len > 0xFFFF ? 0xFFFF : run_len;
+		ST7735_mirror_reserve(5);
+		packet[packet_len++] = ST7735_MIRROR_OP_RUN;
+		packet[packet_len++] = n >> 8;
+		packet[packet_len++] = n;
+		packet[packet_len++] = run_color >> 8;
+		packet[packet_len++] = run_color;
+		pixels_op = -1;
+		run_len -= n;
+	}
+}
+
+/**
+ * @brief Adds pixels of one color, extending the pending run when the color is the same.
+ * @param color The RGB565 color.
+ * @param count Number of pixels.
+ */
+static void ST7735_mirror_add(uint16_t color, uint32_t count) {
+	if (run_len && (color == run_color)) {
+		run_len += count;
+		return;
+	}
+	ST7735_mirror_flush_run();
+	run_color = color;
+	run_len = count;
+}
+
+void ST7735_mirror_start(void) {
+	packet_len = 0;
+	pixels_op = -1;
+	run_len = 0;
+	active = true;
+}
+
+void ST7735_mirror_stop(void) {
+	active = false;
+}
+
+bool ST7735_mirror_active(void) {
+	return active;
+}
+
+uint16_t ST7735_mirror_read(uint8_t *buf, uint16_t size) {
+	uint16_t n = 0;
+	uint16_t tail = ring_tail;
+	while (tail != ring_head) {
+		uint16_t packet_size = ring[(tail + 1) % ST7735_MIRROR_BUF_SIZE] + 3;
+		if (n + packet_size > size)
+			break;
+		for (uint16_t i = 0; i < packet_size; i++) {
+			buf[n++] = ring[tail];
+			tail = (tail + 1) % ST7735_MIRROR_BUF_SIZE;
+		}
+	}
+	ring_tail = tail;
+	return n;
+}
+
+void ST7735_mirror_command(uint8_t command) {
+	if (!active)
+		return;
+	ST7735_mirror_flush_run();
+	ST7735_mirror_reserve(2);
+	packet[packet_len++] = ST7735_MIRROR_OP_COMMAND;
+	packet[packet_len++] = command;
+	pixels_op = -1;
+}
+
+void ST7735_mirror_data(const uint8_t *data, size_t size) {
+	if (!active)
+		return;
+	ST7735_mirror_flush_run();
+	while (size) {
+		uint8_t n = size > ST7735_MIRROR_PAYLOAD_MAX - 2 ? ST7735_MIRROR_PAYLOAD_MAX - 2 : size;
+		ST7735_mirror_reserve(n + 2);
+		packet[packet_len++] = ST7735_MIRROR_OP_DATA;
+		packet[packet_len++] = n;
+		for (uint8_t i = 0; i < n; i++)
+			packet[packet_len++] = data[i];
+		pixels_op = -1;
+		data += n;
+		size -= n;
+	}
+}
+
+void ST7735_mirror_pixels(const uint16_t *pixels, uint32_t count, bool repeat) {
+	if (!active || (count == 0))
+		return;
+	if (repeat) {
+		ST7735_mirror_add(pixels[0], count);
+		return;
+	}
+	for (uint32_t i = 0; i < count; i++)
+		ST7735_mirror_add(pixels[i], 1);
+}
+
+void ST7735_mirror_end(void) {
+	if (!active)
+		return;
+	ST7735_mirror_flush_run();
+	ST7735_mirror_commit();
+}
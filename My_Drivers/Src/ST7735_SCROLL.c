@@ -0,0 +1,106 @@
+/**
+ * TFT display scrolling console and strip chart realisation
+ */
+
+#include "ST7735_SCROLL.h"
+#include <string.h>
+
+/* Size of the display across the scroll axis */
+#define ST7735_SCROLL_ACROSS ST7735_TFTWIDTH_128
+
+void ST7735_console_init(st7735_console_t *console, int16_t y, uint8_t rows, uint16_t color,
+		uint16_t bg) {
+	console->y = y;
+	console->lines = rows * ST7735_CONSOLE_ROW;
+	console->line = 0;
+	console->color = color;
+	console->bg = bg;
+
+	ST7735_begin();
+	ST7735_scroll_area(y, console->lines);
+	ST7735_fill_rect(0, y, ST7735_SCROLL_ACROSS, console->lines, bg);
+	ST7735_end();
+}
+
+void ST7735_console_print(st7735_console_t *console, const char *text) {
+	char row[ST7735_SCROLL_ACROSS / 2];
+
+	ST7735_begin();
+	do {
+		/* Cut the next line, characters past the right edge are not shown anyway */
+		size_t n = strcspn(text, "\n");
+		size_t len = 0;
+		for (size_t i = 0; (i < n) && (len < sizeof(row) - 1); i++) {
+			if (text[i] != '\r')
+				row[len++] = text[i];
+		}
+		row[len] = '\0';
+		text += n;
+		/* Step over the separator, a trailing one does not start an empty row */
+		if (*text == '\n')
+			text++;
+
+		/* Overwrite the oldest row and scroll it to the bottom */
+		int16_t y = ST7735_scroll_coord(console->line, ST7735_CONSOLE_ROW);
+		int16_t x = ST7735_text(0, y, row, &font_prop8, console->color, console->bg);
+		ST7735_fill_rect(x, y, ST7735_SCROLL_ACROSS - x, ST7735_CONSOLE_ROW, console->bg);
+		console->line = (console->line + ST7735_CONSOLE_ROW) % console->lines;
+		ST7735_scroll(console->line);
+	} while (*text);
+	ST7735_end();
+}
+
+void ST7735_strip_init(st7735_strip_t *strip, int16_t start, uint16_t length, int32_t min,
+		int32_t max, uint16_t color, uint16_t bg) {
+	strip->start = start;
+	strip->length = length;
+	strip->line = 0;
+	strip->min = min;
+	strip->max = max;
+	strip->color = color;
+	strip->bg = bg;
+	strip->last = -1;
+
+	ST7735_begin();
+	ST7735_scroll_area(start, length);
+	if (ST7735_scroll_horizontal())
+		ST7735_fill_rect(start, 0, length, ST7735_SCROLL_ACROSS, bg);
+	else
+		ST7735_fill_rect(0, start, ST7735_SCROLL_ACROSS, length, bg);
+	ST7735_end();
+}
+
+void ST7735_strip_add(st7735_strip_t *strip, int32_t value) {
+	if (value < strip->min)
+		value = strip->min;
+	if (value > strip->max)
+		value = strip->max;
+	int16_t pos = 0;
+	if (strip->max > strip->min)
+		pos = (int64_t)(value - strip->min) * (ST7735_SCROLL_ACROSS - 1) / (strip->max - strip->min);
+
+	/* Join the sample to the previous one */
+	int16_t lo = pos, hi = pos;
+	if (strip->last >= 0) {
+		lo = strip->last < pos ? strip->last : pos;
+		hi = strip->last > pos ? strip->last : pos;
+	}
+	strip->last = pos;
+
+	/* Redraw the oldest line as background, trace, background */
+	ST7735_begin();
+	int16_t c = ST7735_scroll_coord(strip->line, 1);
+	if (ST7735_scroll_horizontal()) {
+		/* Values grow upwards */
+		ST7735_fill_rect(c, 0, 1, ST7735_SCROLL_ACROSS - 1 - hi, strip->bg);
+		ST7735_fill_rect(c, ST7735_SCROLL_ACROSS - 1 - hi, 1, hi - lo + 1, strip->color);
+		ST7735_fill_rect(c, ST7735_SCROLL_ACROSS - lo, 1, lo, strip->bg);
+	} else {
+		ST7735_fill_rect(0, c, lo, 1, strip->bg);
+		ST7735_fill_rect(lo, c, hi - lo + 1, 1, strip->color);
+		ST7735_fill_rect(hi + 1, c, ST7735_SCROLL_ACROSS - 1 - hi, 1, strip->bg);
+	}
+	strip->line = (strip->line + 1) % strip->length;
+	ST7735_scroll(strip->line);
+	ST7735_end();
+}
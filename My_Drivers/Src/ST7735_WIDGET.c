@@ -0,0 +1,124 @@
+/**
+ * TFT display text widgets realisation
+ */
+
+#include "ST7735_WIDGET.h"
+#include <string.h>
+
+void ST7735_widget_init(st7735_widget_t *widget, int16_t x, int16_t y, uint16_t color, uint16_t bg,
+		uint8_t size_x, uint8_t size_y, uint8_t cells) {
+	widget->x = x;
+	widget->y = y;
+	widget->color = color;
+	widget->bg = bg;
+	widget->size_x = size_x;
+	widget->size_y = size_y;
+	widget->cells = (cells == 0 || cells > ST7735_WIDGET_MAX_LEN - 1) ? ST7735_WIDGET_MAX_LEN - 1
+			: cells;
+	widget->valid = false;
+	widget->text[0] = '\0';
+}
+
+uint8_t ST7735_widget_set_text(st7735_widget_t *widget, const char *text) {
+	uint8_t old_len = strlen(widget->text);
+	uint8_t new_len = 0;
+	uint8_t painted = 0;
+
+	/* The text ends at the line break, the rest is only meant for the UART log */
+	while (text[new_len] && (text[new_len] != '\r') && (text[new_len] != '\n') &&
+			(new_len < widget->cells))
+		new_len++;
+
+	/* All changed cells are drawn in one batch */
+	ST7735_begin();
+	for (uint8_t i = 0; (i < new_len) || (i < old_len); i++) {
+		/* Cells past the end of the new text are cleared with spaces */
+		char c = (i < new_len) ? text[i] : ' ';
+		char shown = (i < old_len) ? widget->text[i] : ' ';
+		if (widget->valid && (c == shown))
+			continue;
+		ST7735_char(widget->x + i * 6 * widget->size_x, widget->y, c, widget->color, widget->bg,
+				widget->size_x, widget->size_y);
+		painted++;
+	}
+	ST7735_end();
+
+	memcpy(widget->text, text, new_len);
+	widget->text[new_len] = '\0';
+	widget->valid = true;
+	return painted;
+}
+
+void ST7735_widget_invalidate(st7735_widget_t *widget) {
+	widget->valid = false;
+}
+
+void ST7735_chart_init(st7735_chart_t *chart, int16_t x, int16_t y, uint8_t w, uint8_t h,
+		int32_t min, int32_t max, uint16_t color, uint16_t bg) {
+	chart->x = x;
+	chart->y = y;
+	/* An empty plot would divide by zero in ST7735_chart_add(), it gets one pixel instead */
+	chart->w = w > ST7735_CHART_MAX_W ? ST7735_CHART_MAX_W : (w ? w : 1);
+	chart->h = h ? h : 1;
+	chart->min = min;
+	chart->max = max;
+	chart->color = color;
+	chart->bg = bg;
+	chart->head = 0;
+	chart->last = ST7735_CHART_EMPTY;
+	chart->valid = false;
+	memset(chart->top, ST7735_CHART_EMPTY, sizeof(chart->top));
+	memset(chart->bottom, ST7735_CHART_EMPTY, sizeof(chart->bottom));
+}
+
+/**
+ * @brief Draws the span of a chart column.
+ * @param chart Pointer to the chart.
+ * @param col Column of the plot.
+ * @param color Color of the span.
+ */
+static void ST7735_chart_span(const st7735_chart_t *chart, uint8_t col, uint16_t color) {
+	if (chart->top[col] == ST7735_CHART_EMPTY)
+		return;
+	ST7735_fill_rect(chart->x + col, chart->y + chart->top[col], 1,
+			chart->bottom[col] - chart->top[col] + 1, color);
+}
+
+void ST7735_chart_add(st7735_chart_t *chart, int32_t value) {
+	if (value < chart->min)
+		value = chart->min;
+	if (value > chart->max)
+		value = chart->max;
+	uint8_t row = chart->h - 1;
+	if (chart->max > chart->min)
+		row -= (int64_t)(value - chart->min) * (chart->h - 1) / (chart->max - chart->min);
+
+	ST7735_begin();
+	if (!chart->valid) {
+		/* Repaint the plot from the retained spans */
+		ST7735_fill_rect(chart->x, chart->y, chart->w, chart->h, chart->bg);
+		for (uint8_t i = 0; i < chart->w; i++)
+			ST7735_chart_span(chart, i, chart->color);
+		chart->valid = true;
+	}
+
+	/* Join the sample to the previous one, a sample after the wrap starts a new trace */
+	uint8_t col = chart->head;
+	uint8_t prev = (col == 0 || chart->last == ST7735_CHART_EMPTY) ? row : chart->last;
+	ST7735_chart_span(chart, col, chart->bg);
+	chart->top[col] = prev < row ? prev : row;
+	chart->bottom[col] = prev > row ? prev : row;
+	ST7735_chart_span(chart, col, chart->color);
+	chart->last = row;
+
+	/* Open the gap ahead of the cursor */
+	chart->head = (col + 1) % chart->w;
+	ST7735_chart_span(chart, chart->head, chart->bg);
+	chart->top[chart->head] = ST7735_CHART_EMPTY;
+	chart->bottom[chart->head] = ST7735_CHART_EMPTY;
+	ST7735_end();
+}
+
+void ST7735_chart_invalidate(st7735_chart_t *chart) {
+	chart->valid = false;
+}
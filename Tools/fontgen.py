@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+Font generator for the ST7735 text engine.
+
+Builds proportional fonts from the classic 5x8 font in My_Drivers/Src/ST7735_FONT.c:
+- the 8 px font is the classic font with its blank columns trimmed;
+- the 16 and 24 px fonts are scaled with scale2x/scale3x, so their edges are smoothed instead
+  of blocky.
+Digits keep a common width so that changing readouts do not shift the text after them.
+
+Every glyph is stored row by row as run lengths of alternating background and ink pixels,
+starting with background. A run longer than 255 pixels is split with a zero-length run.
+
+Usage: python3 Tools/fontgen.py [output.c]
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+SOURCE = os.path.join(ROOT, "My_Drivers", "Src", "ST7735_FONT.c")
+OUTPUT = os.path.join(ROOT, "My_Drivers", "Src", "ST7735_FONTS.c")
+
+FIRST, LAST = 0x20, 0x7E
+SCALES = (1, 2, 3)
+
+
+def load_classic(path):
+    """Returns the classic font as a list of glyphs, each a list of 8 rows of 5 booleans."""
+    with open(path) as f:
+        data = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", f.read())]
+    glyphs = []
+    for c in range(len(data) // 5):
+        cols = data[c * 5:c * 5 + 5]
+        glyphs.append([[bool(col >> row & 1) for col in cols] for row in range(8)])
+    return glyphs
+
+
+def scale2x(img):
+    h, w = len(img), len(img[0])
+    px = lambda x, y: 0 <= x < w and 0 <= y < h and img[y][x]
+    out = [[False] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c, d, e = px(x, y - 1), px(x + 1, y), px(x - 1, y), px(x, y + 1), px(x, y)
+            out[2 * y][2 * x] = a if (c == a and c != d and a != b) else e
+            out[2 * y][2 * x + 1] = b if (a == b and a != c and b != d) else e
+            out[2 * y + 1][2 * x] = c if (d == c and d != b and c != a) else e
+            out[2 * y + 1][2 * x + 1] = d if (b == d and b != a and d != c) else e
+    return out
+
+
+def scale3x(img):
+    h, w = len(img), len(img[0])
+    px = lambda x, y: 0 <= x < w and 0 <= y < h and img[y][x]
+    out = [[False] * (w * 3) for _ in range(h * 3)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c = px(x - 1, y - 1), px(x, y - 1), px(x + 1, y - 1)
+            d, e, f = px(x - 1, y), px(x, y), px(x + 1, y)
+            g, hh, i = px(x - 1, y + 1), px(x, y + 1), px(x + 1, y + 1)
+            cells = [
+                d if (d == b and b != f and d != hh) else e,
+                b if ((d == b and b != f and d != hh and e != c) or
+                      (b == f and b != d and f != hh and e != a)) else e,
+                f if (b == f and b != d and f != hh) else e,
+                d if ((d == b and b != f and d != hh and e != g) or
+                      (d == hh and d != b and hh != f and e != a)) else e,
+                e,
+                f if ((b == f and b != d and f != hh and e != i) or
+                      (hh == f and d != hh and b != f and e != c)) else e,
+                d if (d == hh and d != b and hh != f) else e,
+                hh if ((d == hh and d != b and hh != f and e != i) or
+                       (hh == f and d != hh and b != f and e != g)) else e,
+                f if (hh == f and d != hh and b != f) else e,
+            ]
+            for k, v in enumerate(cells):
+                out[3 * y + k // 3][3 * x + k % 3] = v
+    return out
+
+
+def scale(img, k):
+    return {1: lambda i: i, 2: scale2x, 3: scale3x}[k](img)
+
+
+def trim(img, k, width=None):
+    """Crops blank columns and appends k columns of spacing, or centers the ink in width."""
+    used = [x for x in range(len(img[0])) if any(row[x] for row in img)]
+    if not used:
+        return [[False] * (width or 3 * k) for _ in img]
+    ink = [row[used[0]:used[-1] + 1] for row in img]
+    if width is None:
+        return [row + [False] * k for row in ink]
+    left = (width - k - len(ink[0])) // 2
+    return [[False] * left + row + [False] * (width - left - len(row)) for row in ink]
+
+
+def rle(img):
+    runs, ink, n = [], False, 0
+    for px in (p for row in img for p in row):
+        if px == ink:
+            n += 1
+            continue
+        runs.append(n)
+        ink, n = px, 1
+    runs.append(n)
+    out = []
+    for n in runs:
+        while n > 255:
+            out += [255, 0]
+            n -= 255
+        out.append(n)
+    return out
+
+
+def build(classic, k):
+    glyphs = {c: scale(classic[c], k) for c in range(FIRST, LAST + 1)}
+    digits = [trim(glyphs[c], k) for c in range(ord("0"), ord("9") + 1)]
+    digit_width = max(len(g[0]) for g in digits)
+    bitmap, table = [], []
+    for c in range(FIRST, LAST + 1):
+        img = trim(glyphs[c], k, digit_width if chr(c).isdigit() else None)
+        table.append((len(bitmap), len(img[0])))
+        bitmap += rle(img)
+    return 8 * k, bitmap, table
+
+
+def emit(fonts, path):
+    lines = [
+        "/**",
+        " * Proportional fonts for the ST7735 text engine",
+        " * Generated by Tools/fontgen.py from ST7735_FONT.c, do not edit.",
+        " */",
+        "",
+        "#include \"ST7735_FONTS.h\"",
+        "",
+    ]
+    for height, bitmap, table in fonts:
+        name = "font_prop%d" % height
+        lines.append("static const uint8_t %s_bitmap[] = {" % name)
+        for i in range(0, len(bitmap), 16):
+            lines.append("\t\t" + " ".join("0x%02X," % b for b in bitmap[i:i + 16]))
+        lines.append("};")
+        lines.append("")
+        lines.append("static const st7735_glyph_t %s_glyphs[] = {" % name)
+        for c, (offset, width) in zip(range(FIRST, LAST + 1), table):
+            ch = chr(c).replace("\\", "\\\\")
+            lines.append("\t\t{%d, %d}, /* '%s' */" % (offset, width, ch))
+        lines.append("};")
+        lines.append("")
+        lines.append("const st7735_font_t %s = {" % name)
+        lines.append("\t\t%s_bitmap, %s_glyphs, 0x%02X, 0x%02X, %d};" % (name, name, FIRST, LAST,
+                                                                           height))
+        lines.append("")
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    classic = load_classic(SOURCE)
+    emit([build(classic, k) for k in SCALES], sys.argv[1] if len(sys.argv) > 1 else OUTPUT)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+Image converter for the ST7735 image blitter.
+
+Converts images into run-length encoded st7735_image_t definitions:
+- ASCII art (.txt): '#' is ink and any other character is background, stored as a 1-bit image
+  drawn with colors chosen at run time;
+- PBM (.pbm, P1/P4): stored as a 1-bit image;
+- PPM (.ppm, P3/P6): stored as an RGB565 image.
+
+1-bit images are stored row by row as byte run lengths of alternating background and ink pixels,
+starting with background. A run longer than 255 pixels is split with a zero-length run.
+
+RGB565 images are stored as 16-bit words. A word with bit 15 set starts a repeat and is followed
+by one pixel drawn (word & 0x7FFF) + 1 times. A word with bit 15 clear starts a literal and is
+followed by (word & 0x7FFF) + 1 pixels.
+
+The image name is the file name without extension.
+
+Usage: python3 Tools/img2rle.py -o source.c -H header.h image [image ...]
+"""
+
+import argparse
+import os
+
+MAX_RUN = 0x8000
+
+
+def read_tokens(data, count, pos):
+    """Reads count whitespace separated netpbm header tokens, skipping comments."""
+    tokens = []
+    while len(tokens) < count:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while data[pos:pos + 1] and not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    return tokens, pos + 1
+
+
+def load(path):
+    """Returns (width, height, pixels, is_bitmap), pixels is a row-major list."""
+    if path.endswith(".txt"):
+        with open(path) as f:
+            rows = [line.rstrip("\n") for line in f if line.strip()]
+        w = max(len(r) for r in rows)
+        return w, len(rows), [r.ljust(w, ".")[x] == "#" for r in rows for x in range(w)], True
+
+    with open(path, "rb") as f:
+        data = f.read()
+    magic = data[:2]
+    if magic in (b"P1", b"P4"):
+        (w, h), pos = read_tokens(data, 2, 2)
+        w, h = int(w), int(h)
+        if magic == b"P1":
+            bits = [c == ord("1") for c in data[pos - 1:] if c in b"01"]
+        else:
+            stride = (w + 7) // 8
+            bits = [bool(data[pos + y * stride + x // 8] >> (7 - x % 8) & 1)
+                    for y in range(h) for x in range(w)]
+        return w, h, bits[:w * h], True
+    if magic in (b"P3", b"P6"):
+        (w, h, maxval), pos = read_tokens(data, 3, 2)
+        w, h, maxval = int(w), int(h), int(maxval)
+        if magic == b"P3":
+            values = [int(v) for v in data[pos - 1:].split()]
+        else:
+            values = list(data[pos:pos + w * h * 3])
+        rgb = [[v * 255 // maxval for v in values[i:i + 3]] for i in range(0, w * h * 3, 3)]
+        pixels = [(r >> 3) << 11 | (g >> 2) << 5 | b >> 3 for r, g, b in rgb]
+        return w, h, pixels, False
+    raise SystemExit("%s: unsupported image format" % path)
+
+
+def encode_bitmap(pixels):
+    runs, ink, n = [], False, 0
+    for px in pixels:
+        if px == ink:
+            n += 1
+            continue
+        runs.append(n)
+        ink, n = px, 1
+    runs.append(n)
+    out = []
+    for n in runs:
+        while n > 255:
+            out += [255, 0]
+            n -= 255
+        out.append(n)
+    return out
+
+
+def encode_rgb565(pixels):
+    out, literal, i = [], [], 0
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.extend([len(chunk) - 1] + chunk)
+
+    while i < len(pixels):
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == pixels[i] and n < MAX_RUN:
+            n += 1
+        # Repeats of two pixels cost as much as a literal, keep them in the literal
+        if n >= 3:
+            flush()
+            out += [0x8000 | (n - 1), pixels[i]]
+        else:
+            literal.extend(pixels[i:i + n])
+        i += n
+    flush()
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[1])
+    parser.add_argument("-o", "--output", required=True, help="C source to write")
+    parser.add_argument("-H", "--header", required=True, help="C header to write")
+    parser.add_argument("images", nargs="+")
+    args = parser.parse_args()
+
+    guard = "__%s__" % os.path.basename(args.header).upper().replace(".", "_")
+    src = [
+        "/**",
+        " * Images for the ST7735 image blitter",
+        " * Generated by Tools/img2rle.py, do not edit.",
+        " */",
+        "",
+        "#include \"%s\"" % os.path.basename(args.header),
+        "",
+    ]
+    hdr = [
+        "/**",
+        " * Images for the ST7735 image blitter header",
+        " * Generated by Tools/img2rle.py, do not edit.",
+        " */",
+        "",
+        "#ifndef %s" % guard,
+        "#define %s" % guard,
+        "",
+        "#include \"ST7735.h\"",
+        "",
+    ]
+    for path in args.images:
+        name = os.path.splitext(os.path.basename(path))[0]
+        w, h, pixels, bitmap = load(path)
+        if bitmap:
+            data, ctype, fmt, digits = encode_bitmap(pixels), "uint8_t", "ST7735_IMAGE_RLE1", 2
+        else:
+            data, ctype, fmt, digits = encode_rgb565(pixels), "uint16_t", "ST7735_IMAGE_RLE565", 4
+        per_line = 16 if bitmap else 10
+        src.append("static const %s %s_data[] = {" % (ctype, name))
+        for i in range(0, len(data), per_line):
+            src.append("\t\t" + " ".join("0x%0*X," % (digits, v) for v in data[i:i + per_line]))
+        src.append("};")
+        src.append("")
+        src.append("const st7735_image_t %s = {%d, %d, %s, %s_data};" % (name, w, h, fmt, name))
+        src.append("")
+        kind = "1-bit" if bitmap else "RGB565"
+        hdr.append("/* %dx%d %s image, %d bytes */" % (w, h, kind, len(data) * (1 if bitmap else 2)))
+        hdr.append("extern const st7735_image_t %s;" % name)
+    hdr += ["", "#endif /* %s */" % guard, ""]
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(src))
+    with open(args.header, "w") as f:
+        f.write("\n".join(hdr))
+
+
+if __name__ == "__main__":
+    main()
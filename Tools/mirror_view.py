@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+"""
+Viewer of the mirrored display of a monitoring unit.
+
+The unit streams everything its display driver sends to the ST7735 as compressed packets over
+USART1 (see My_Drivers/Inc/ST7735_MIRROR.h), mixed with its usual text telemetry. This tool
+sends the start command, decodes the packets with a model of the display controller and keeps
+the reconstructed screen in a PPM image; the telemetry lines are printed as they arrive.
+
+Usage:
+  python3 Tools/mirror_view.py --port /dev/ttyUSB0 [--baud 115200] [-o screen.ppm] [--show]
+      Mirrors a unit until Ctrl+C, the image is rewritten whenever the screen changed.
+      --show opens a window with the live screen (needs tkinter).
+  python3 Tools/mirror_view.py capture.bin [more.bin ...]
+      Decodes captured streams one after the other and saves capture.ppm, more.ppm, ...
+      with the screen as it was at the end of every file. Reading from a serial port
+      needs pyserial.
+"""
+
+import argparse
+import os
+import sys
+import time
+
+SYNC = 0xA5
+OP_COMMAND, OP_DATA, OP_RUN, OP_PIXELS = 0x01, 0x02, 0x03, 0x04
+
+# Controller commands
+SWRESET, SLPIN, SLPOUT, NORON = 0x01, 0x10, 0x11, 0x13
+INVOFF, INVON, DISPOFF, DISPON = 0x20, 0x21, 0x28, 0x29
+CASET, RASET, RAMWR, MADCTL = 0x2A, 0x2B, 0x2C, 0x36
+VSCRDEF, VSCRSADD = 0x33, 0x37
+MADCTL_MY, MADCTL_MX, MADCTL_MV, MADCTL_BGR = 0x80, 0x40, 0x20, 0x08
+
+WIDTH, HEIGHT, MEMORY_LINES = 128, 160, 160
+
+CMD_MIRROR_ON, CMD_MIRROR_OFF = b"M", b"m"
+
+
+class Panel:
+    """Model of the ST7735 controller, the same one as Tools/st7735_sim/sim_panel.c."""
+
+    def __init__(self):
+        self.gram = [[0] * WIDTH for _ in range(MEMORY_LINES)]
+        self.reset()
+        self.sleeping = False
+        self.display_on = True
+
+    def reset(self):
+        self.madctl = 0
+        self.col_start, self.col_end = 0, WIDTH - 1
+        self.row_start, self.row_end = 0, HEIGHT - 1
+        self.col, self.row = 0, 0
+        self.command = None
+        self.args = []
+        self.sleeping, self.display_on, self.inverted = True, False, False
+        self.scroll_top, self.scroll_lines, self.scroll_start = 0, MEMORY_LINES, 0
+
+    def write_command(self, command):
+        self.command = command
+        self.args = []
+        if command == SWRESET:
+            self.reset()
+            self.command = command
+        elif command == SLPIN:
+            self.sleeping = True
+        elif command == SLPOUT:
+            self.sleeping = False
+        elif command == DISPOFF:
+            self.display_on = False
+        elif command == DISPON:
+            self.display_on = True
+        elif command == INVOFF:
+            self.inverted = False
+        elif command == INVON:
+            self.inverted = True
+        elif command == NORON:
+            self.scroll_start = self.scroll_top
+        elif command == RAMWR:
+            self.col, self.row = self.col_start, self.row_start
+
+    def write_data(self, data):
+        self.args.extend(data)
+        a = self.args
+        if self.command == CASET and len(a) == 4:
+            self.col_start, self.col_end = (a[0] << 8) | a[1], (a[2] << 8) | a[3]
+        elif self.command == RASET and len(a) == 4:
+            self.row_start, self.row_end = (a[0] << 8) | a[1], (a[2] << 8) | a[3]
+        elif self.command == MADCTL and len(a) == 1:
+            self.madctl = a[0]
+        elif self.command == VSCRDEF and len(a) == 6:
+            self.scroll_top, self.scroll_lines = (a[0] << 8) | a[1], (a[2] << 8) | a[3]
+        elif self.command == VSCRSADD and len(a) == 2:
+            self.scroll_start = (a[0] << 8) | a[1]
+
+    def write_pixels(self, color, count):
+        """Writes count pixels of one color at the cursor, the cursor wraps in the window."""
+        if self.command != RAMWR:
+            return
+        mv = self.madctl & MADCTL_MV
+        if self.madctl & MADCTL_BGR:
+            color = ((color << 11) & 0xF800) | (color & 0x07E0) | (color >> 11)
+        for _ in range(count):
+            x, y = (self.row, self.col) if mv else (self.col, self.row)
+            if self.madctl & MADCTL_MX:
+                x = WIDTH - 1 - x
+            if self.madctl & MADCTL_MY:
+                y = HEIGHT - 1 - y
+            if 0 <= x < WIDTH and 0 <= y < MEMORY_LINES:
+                self.gram[y][x] = color
+            if self.col >= self.col_end:
+                self.col = self.col_start
+                self.row = self.row_start if self.row >= self.row_end else self.row + 1
+            else:
+                self.col += 1
+
+    def pixel(self, x, y):
+        if self.sleeping or not self.display_on:
+            return 0
+        line = y
+        if self.scroll_top <= y < self.scroll_top + self.scroll_lines:
+            line = self.scroll_start + (y - self.scroll_top)
+            if line >= self.scroll_top + self.scroll_lines:
+                line -= self.scroll_lines
+        color = self.gram[line][x] if 0 <= line < MEMORY_LINES else 0
+        return color ^ 0xFFFF if self.inverted else color
+
+    def ppm(self):
+        out = bytearray(b"P6\n%d %d\n255\n" % (WIDTH, HEIGHT))
+        for y in range(HEIGHT):
+            for x in range(WIDTH):
+                c = self.pixel(x, y)
+                r, g, b = c >> 11, (c >> 5) & 0x3F, c & 0x1F
+                out += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+        return bytes(out)
+
+
+class Decoder:
+    """Splits the byte stream into text and packets and applies the packets to the panel."""
+
+    def __init__(self, panel, text_out):
+        self.panel = panel
+        self.text_out = text_out
+        self.buf = bytearray()
+        self.packets = 0
+        self.bad_packets = 0
+        self.packet_bytes = 0
+
+    def feed(self, data):
+        """Decodes the bytes, returns True if any packet was applied."""
+        self.buf += data
+        changed = False
+        while self.buf:
+            start = self.buf.find(SYNC)
+            if start != 0:
+                text = self.buf if start < 0 else self.buf[:start]
+                self.text_out(bytes(text))
+                del self.buf[:len(text)]
+                continue
+            if len(self.buf) < 2 or len(self.buf) < self.buf[1] + 3:
+                break
+            size = self.buf[1]
+            payload = bytes(self.buf[2:2 + size])
+            check = 0
+            for b in payload:
+                check ^= b
+            if check != self.buf[2 + size]:
+                # Not a packet after all, or a damaged one: resynchronize on the next sync byte
+                self.bad_packets += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:size + 3]
+            self.packets += 1
+            self.packet_bytes += size + 3
+            self.apply(payload)
+            changed = True
+        return changed
+
+    def apply(self, p):
+        i = 0
+        while i < len(p):
+            op = p[i]
+            if op == OP_COMMAND:
+                self.panel.write_command(p[i + 1])
+                i += 2
+            elif op == OP_DATA:
+                n = p[i + 1]
+                self.panel.write_data(p[i + 2:i + 2 + n])
+                i += 2 + n
+            elif op == OP_RUN:
+                self.panel.write_pixels((p[i + 3] << 8) | p[i + 4], (p[i + 1] << 8) | p[i + 2])
+                i += 5
+            elif op == OP_PIXELS:
+                n = p[i + 1]
+                for k in range(n):
+                    self.panel.write_pixels((p[i + 2 + 2 * k] << 8) | p[i + 3 + 2 * k], 1)
+                i += 2 + 2 * n
+            else:
+                raise ValueError("unknown operation 0x%02X" % op)
+
+
+def save_ppm(path, data):
+    tmp = path + ".tmp"
+    with open(tmp, "wb") as f:
+        f.write(data)
+    os.replace(tmp, path)
+
+
+def print_text(data):
+    sys.stdout.write(data.decode("ascii", "replace"))
+    sys.stdout.flush()
+
+
+def decode_files(paths):
+    panel = Panel()
+    decoder = Decoder(panel, print_text)
+    for path in paths:
+        with open(path, "rb") as f:
+            decoder.feed(f.read())
+        out = os.path.splitext(path)[0] + ".ppm"
+        save_ppm(out, panel.ppm())
+        print("%s: %d packets, %d bytes -> %s" % (path, decoder.packets, decoder.packet_bytes, out),
+              file=sys.stderr)
+        decoder.packets = decoder.packet_bytes = 0
+    if decoder.bad_packets:
+        print("%d damaged packets" % decoder.bad_packets, file=sys.stderr)
+
+
+def mirror_port(args):
+    try:
+        import serial
+    except ImportError:
+        sys.exit("reading a serial port needs pyserial: pip install pyserial")
+
+    window = None
+    if args.show:
+        import tkinter
+        root = tkinter.Tk()
+        root.title("Display mirror")
+        window = tkinter.Label(root)
+        window.pack()
+
+    panel = Panel()
+    decoder = Decoder(panel, print_text)
+    port = serial.Serial(args.port, args.baud, timeout=0.05)
+    port.write(CMD_MIRROR_ON)
+    last_save = 0.0
+    dirty = False
+    try:
+        while True:
+            dirty |= decoder.feed(port.read(4096))
+            # The image is rebuilt at most a few times per second, the stream is much slower
+            if dirty and (time.monotonic() - last_save > 0.25):
+                data = panel.ppm()
+                save_ppm(args.output, data)
+                if window is not None:
+                    image = tkinter.PhotoImage(data=data).zoom(args.zoom)
+                    window.configure(image=image)
+                    window.image = image
+                dirty = False
+                last_save = time.monotonic()
+            if window is not None:
+                root.update()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        port.write(CMD_MIRROR_OFF)
+        port.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("files", nargs="*", help="captured streams to decode")
+    parser.add_argument("--port", help="serial port of the unit")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("-o", "--output", default="mirror.ppm", help="image of the live screen")
+    parser.add_argument("--show", action="store_true", help="show the live screen in a window")
+    parser.add_argument("--zoom", type=int, default=3, help="magnification of the window")
+    args = parser.parse_args()
+
+    if args.port:
+        mirror_port(args)
+    elif args.files:
+        decode_files(args.files)
+    else:
+        parser.error("give a serial port or captured streams")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,83 @@
+/**
+ * Virtual board realisation
+ */
+
+#include "sim_board.h"
+#include "common.h"
+#include "remote.h"
+
+/* Handles common.c expects from the CubeMX code, only the timers are ever written */
+static TIM_TypeDef tim3_regs, tim4_regs;
+ADC_HandleTypeDef hadc1;
+I2C_HandleTypeDef hi2c1, hi2c2, hi2c3;
+TIM_HandleTypeDef htim3 = {.Instance = &tim3_regs};
+TIM_HandleTypeDef htim4 = {.Instance = &tim4_regs};
+
+/* Sensor handles of init.c */
+struct BMP280_HandleTypedef bmp280;
+struct AHT10_HandleTypedef aht10;
+struct CCS811_HandleTypedef ccs811;
+
+/* Readings of the virtual sensors */
+static sim_readings_t readings;
+
+/* UART log bytes since the last sim_board_uart_bytes() call */
+static uint32_t uart_bytes;
+
+void sim_board_readings(const sim_readings_t *r) {
+	readings = *r;
+}
+
+uint32_t sim_board_uart_bytes(void) {
+	uint32_t n = uart_bytes;
+	uart_bytes = 0;
+	return n;
+}
+
+uint8_t tft_display_init(void) {
+	/* Same steps as init.c, which also brings up the sensors */
+	ST7735_init();
+	ST7735_fill(ST7735_BLACK);
+	ST7735_flush();
+	return INIT_OK;
+}
+
+uint8_t barometr_sensor_init(I2C_HandleTypeDef *_hi2c2) {
+	(void)_hi2c2;
+	return INIT_OK;
+}
+
+uint8_t humidity_sensor_init(I2C_HandleTypeDef *_hi2c1) {
+	(void)_hi2c1;
+	return INIT_OK;
+}
+
+uint8_t co2_sensor_init(I2C_HandleTypeDef *_hi2c) {
+	(void)_hi2c;
+	return INIT_OK;
+}
+
+void get_sensor_readings(struct AHT10_HandleTypedef *aht10_device,
+		struct BMP280_HandleTypedef *device, struct CCS811_HandleTypedef *ccs811_device,
+		sensor_readings_t *out) {
+	(void)aht10_device;
+	(void)device;
+	(void)ccs811_device;
+	/* Humidity and pressure are scaled by 100 as sensors.c returns them */
+	out->humidity = readings.hum * 100;
+	out->pressure = readings.press * 100;
+	out->temperature = readings.temp;
+	out->co2 = readings.co2;
+	out->tvoc = readings.tvoc;
+	out->co2_ready = true;
+}
+
+uint32_t calculate_brightness(ADC_HandleTypeDef *_hadc1) {
+	(void)_hadc1;
+	return readings.light;
+}
+
+void remote_send(const uint8_t *data, uint16_t size) {
+	(void)data;
+	uart_bytes += size;
+}
@@ -0,0 +1,39 @@
+/**
+ * Virtual board header
+ *
+ * Host replacement of the sensor and UART side of the firmware, so that the screens are drawn by
+ * common.c and display.c as they are. The sensors return the readings set by the simulation,
+ * the UART log is counted and dropped.
+ */
+
+#ifndef __SIM_BOARD_H__
+#define __SIM_BOARD_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Readings returned by the virtual sensors.
+ * @param hum Humidity in %
+ * @param press Pressure in mmHg
+ * @param temp Temperature in degrees Celsius
+ * @param co2 eCO2 in ppm
+ * @param tvoc TVOC in ppb
+ * @param light Brightness in lux
+ */
+typedef struct {
+	int32_t hum, press, temp, co2, tvoc, light;
+} sim_readings_t;
+
+/**
+ * @brief Sets the readings returned by the next sensor reads.
+ * @param readings The readings.
+ */
+void sim_board_readings(const sim_readings_t *readings);
+
+/**
+ * @brief Returns the number of UART log bytes sent since the last call.
+ */
+uint32_t sim_board_uart_bytes(void);
+
+#endif /* __SIM_BOARD_H__ */
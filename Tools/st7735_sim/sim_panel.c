@@ -0,0 +1,407 @@
+/**
+ * Virtual TFT display panel realisation
+ */
+
+#include "sim_panel.h"
+#include "ST7735.h"
+#include "cmsis_os.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Rows of the panel memory taking part in vertical scrolling */
+#define SIM_MEMORY_LINES ST7735_MEMORY_LINES
+
+/* Longest argument list decoded, longer ones are only counted */
+#define SIM_MAX_ARGS 16
+
+/* Handles and registers the driver expects from the CubeMX code */
+static SPI_TypeDef spi_regs;
+static DMA_Stream_TypeDef dma_regs = {.CR = DMA_SxCR_MINC};
+static DMA_HandleTypeDef hdma_spi2_tx = {.Instance = &dma_regs};
+SPI_HandleTypeDef hspi2 = {.Instance = &spi_regs, .hdmatx = &hdma_spi2_tx};
+osMutexId_t ScreenMutexHandle;
+
+/* Panel memory, including the lines past the visible area reached by scrolling */
+static uint16_t gram[SIM_MEMORY_LINES][SIM_PANEL_W];
+
+/* Controller state */
+static bool selected, data_mode;
+static uint8_t command;
+static uint8_t args[SIM_MAX_ARGS];
+static uint8_t arg_count;
+static uint8_t madctl;
+static uint16_t col_start, col_end = SIM_PANEL_W - 1, row_start, row_end = SIM_PANEL_H - 1;
+static uint16_t col, row;
+static bool byte_pending;
+static uint8_t byte_high;
+static bool sleeping = true, display_on, inverted;
+static uint16_t scroll_top, scroll_lines = SIM_MEMORY_LINES, scroll_start;
+
+/* Traffic counters */
+static sim_stats_t stats;
+
+/* Fake tick advanced by HAL_Delay(), nothing waits on the host */
+static uint32_t tick;
+
+/* Depth of the screen mutex, taken by the driver around every drawing */
+static uint32_t mutex_depth;
+
+void sim_panel_reset(void) {
+	memset(gram, 0, sizeof(gram));
+	madctl = 0;
+	col_start = 0;
+	col_end = SIM_PANEL_W - 1;
+	row_start = 0;
+	row_end = SIM_PANEL_H - 1;
+	col = row = 0;
+	byte_pending = false;
+	sleeping = true;
+	display_on = false;
+	inverted = false;
+	scroll_top = 0;
+	scroll_lines = SIM_MEMORY_LINES;
+	scroll_start = 0;
+}
+
+void sim_get_stats(sim_stats_t *out) {
+	*out = stats;
+}
+
+void sim_reset_stats(void) {
+	stats = (sim_stats_t){0};
+}
+
+/**
+ * @brief Stores a pixel at the write cursor and advances it.
+ * @details The cursor walks the columns of the window, then its rows. The address is exchanged
+ * with MV first, then mirrored with MX and MY along the panel axes.
+ * @param color The RGB565 color as sent.
+ */
+static void sim_write_pixel(uint16_t color) {
+	int32_t x = (madctl & ST77XX_MADCTL_MV) ? row : col;
+	int32_t y = (madctl & ST77XX_MADCTL_MV) ? col : row;
+	if (madctl & ST77XX_MADCTL_MX)
+		x = SIM_PANEL_W - 1 - x;
+	if (madctl & ST77XX_MADCTL_MY)
+		y = SIM_PANEL_H - 1 - y;
+	if (madctl & ST7735_MADCTL_BGR)
+		color = (color << 11) | (color & 0x07E0) | (color >> 11);
+	if ((x >= 0) && (x < SIM_PANEL_W) && (y >= 0) && (y < SIM_MEMORY_LINES))
+		gram[y][x] = color;
+	stats.pixels++;
+
+	if (col++ >= col_end) {
+		col = col_start;
+		if (row++ >= row_end)
+			row = row_start;
+	}
+}
+
+/**
+ * @brief Applies a command once all of its arguments arrived.
+ */
+static void sim_command_args(void) {
+	switch (command) {
+		case ST77XX_CASET:
+			if (arg_count == 4) {
+				col_start = (args[0] << 8) | args[1];
+				col_end = (args[2] << 8) | args[3];
+			}
+			break;
+		case ST77XX_RASET:
+			if (arg_count == 4) {
+				row_start = (args[0] << 8) | args[1];
+				row_end = (args[2] << 8) | args[3];
+			}
+			break;
+		case ST77XX_MADCTL:
+			if (arg_count == 1)
+				madctl = args[0];
+			break;
+		case ST77XX_VSCRDEF:
+			if (arg_count == 6) {
+				scroll_top = (args[0] << 8) | args[1];
+				scroll_lines = (args[2] << 8) | args[3];
+			}
+			break;
+		case ST77XX_VSCRSADD:
+			if (arg_count == 2)
+				scroll_start = (args[0] << 8) | args[1];
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * @brief Decodes one byte received by the controller.
+ * @param byte The byte on the wire.
+ */
+static void sim_receive(uint8_t byte) {
+	stats.bytes++;
+	if (!selected) {
+		stats.stray++;
+		return;
+	}
+
+	if (!data_mode) {
+		stats.commands++;
+		command = byte;
+		arg_count = 0;
+		byte_pending = false;
+		switch (command) {
+			case ST77XX_SWRESET:
+				madctl = 0;
+				sleeping = true;
+				display_on = false;
+				inverted = false;
+				scroll_top = 0;
+				scroll_lines = SIM_MEMORY_LINES;
+				scroll_start = 0;
+				break;
+			case ST77XX_SLPIN:
+				sleeping = true;
+				break;
+			case ST77XX_SLPOUT:
+				sleeping = false;
+				break;
+			case ST77XX_DISPOFF:
+				display_on = false;
+				break;
+			case ST77XX_DISPON:
+				display_on = true;
+				break;
+			case ST77XX_INVOFF:
+				inverted = false;
+				break;
+			case ST77XX_INVON:
+				inverted = true;
+				break;
+			case ST77XX_NORON:
+				/* Leaving the scrolling mode restores the memory order */
+				scroll_start = scroll_top;
+				break;
+			case ST77XX_RAMWR:
+				col = col_start;
+				row = row_start;
+				break;
+			default:
+				break;
+		}
+		return;
+	}
+
+	if (command == ST77XX_RAMWR) {
+		/* Pixels are sent high byte first */
+		if (byte_pending)
+			sim_write_pixel((byte_high << 8) | byte);
+		else
+			byte_high = byte;
+		byte_pending = !byte_pending;
+		return;
+	}
+
+	if (arg_count < SIM_MAX_ARGS)
+		args[arg_count] = byte;
+	arg_count++;
+	sim_command_args();
+}
+
+uint16_t sim_panel_pixel(int16_t x, int16_t y) {
+	if (sleeping || !display_on)
+		return 0x0000;
+
+	/* Lines of the scrolling area show the memory from the scroll start on, wrapping around */
+	int32_t line = y;
+	if ((y >= scroll_top) && (y < scroll_top + scroll_lines)) {
+		line = scroll_start + (y - scroll_top);
+		if (line >= scroll_top + scroll_lines)
+			line -= scroll_lines;
+	}
+	uint16_t color = ((line >= 0) && (line < SIM_MEMORY_LINES)) ? gram[line][x] : 0x0000;
+	return inverted ? ~color : color;
+}
+
+/**
+ * @brief Expands an RGB565 color to 8 bits per channel.
+ * @param color The RGB565 color.
+ * @param rgb The red, green and blue bytes.
+ */
+static void sim_rgb888(uint16_t color, uint8_t rgb[3]) {
+	uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+	rgb[0] = (r << 3) | (r >> 2);
+	rgb[1] = (g << 2) | (g >> 4);
+	rgb[2] = (b << 3) | (b >> 2);
+}
+
+bool sim_panel_save(const char *path) {
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return false;
+	fprintf(f, "P6\n%d %d\n255\n", SIM_PANEL_W, SIM_PANEL_H);
+	for (int16_t y = 0; y < SIM_PANEL_H; y++) {
+		for (int16_t x = 0; x < SIM_PANEL_W; x++) {
+			uint8_t rgb[3];
+			sim_rgb888(sim_panel_pixel(x, y), rgb);
+			fwrite(rgb, 1, 3, f);
+		}
+	}
+	return fclose(f) == 0;
+}
+
+int32_t sim_panel_compare(const char *path) {
+	FILE *f = fopen(path, "rb");
+	if (!f)
+		return -1;
+	int w, h, max;
+	if ((fscanf(f, "P6 %d %d %d", &w, &h, &max) != 3) || (fgetc(f) == EOF) ||
+			(w != SIM_PANEL_W) || (h != SIM_PANEL_H) || (max != 255)) {
+		fclose(f);
+		return -1;
+	}
+
+	int32_t diff = 0;
+	for (int16_t y = 0; y < SIM_PANEL_H; y++) {
+		for (int16_t x = 0; x < SIM_PANEL_W; x++) {
+			uint8_t rgb[3], ref[3];
+			sim_rgb888(sim_panel_pixel(x, y), rgb);
+			if (fread(ref, 1, 3, f) != 3) {
+				fclose(f);
+				return -1;
+			}
+			if (memcmp(rgb, ref, 3))
+				diff++;
+		}
+	}
+	fclose(f);
+	return diff;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+	if ((GPIOx == LCD_CS_GPIO_Port) && (GPIO_Pin == LCD_CS_Pin)) {
+		bool select = (PinState == GPIO_PIN_RESET);
+		if (select && !selected)
+			stats.selects++;
+		/* Releasing the chip select ends a memory write and drops a half pixel */
+		if (!select)
+			byte_pending = false;
+		selected = select;
+	} else if ((GPIOx == LCD_A0_GPIO_Port) && (GPIO_Pin == LCD_A0_Pin)) {
+		data_mode = (PinState == GPIO_PIN_SET);
+	} else if ((GPIOx == LCD_RESET_GPIO_Port) && (GPIO_Pin == LCD_RESET_Pin)) {
+		if (PinState == GPIO_PIN_RESET)
+			sim_panel_reset();
+	}
+}
+
+/**
+ * @brief Sends frames to the panel, 16-bit frames go out high byte first.
+ * @param hspi Pointer to the SPI handle.
+ * @param data The frames.
+ * @param size Number of frames.
+ * @param repeat True to send the first frame size times, as the DMA does without MINC.
+ */
+static void sim_transmit(SPI_HandleTypeDef *hspi, const uint8_t *data, uint16_t size, bool repeat) {
+	stats.transactions++;
+	bool wide = READ_BIT(hspi->Instance->CR1, SPI_CR1_DFF);
+	for (uint16_t i = 0; i < size; i++) {
+		uint16_t n = repeat ? 0 : i;
+		if (wide) {
+			uint16_t frame = ((const uint16_t *)data)[n];
+			sim_receive(frame >> 8);
+			sim_receive(frame & 0xFF);
+		} else {
+			sim_receive(data[n]);
+		}
+	}
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size,
+		uint32_t Timeout) {
+	(void)Timeout;
+	sim_transmit(hspi, pData, Size, false);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size) {
+	/* The transfer completes at once, the callback runs before returning */
+	sim_transmit(hspi, pData, Size, !READ_BIT(hspi->hdmatx->Instance->CR, DMA_SxCR_MINC));
+	HAL_SPI_TxCpltCallback(hspi);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Abort(SPI_HandleTypeDef *hspi) {
+	(void)hspi;
+	return HAL_OK;
+}
+
+__attribute__((weak)) void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+	(void)hspi;
+}
+
+void HAL_Delay(uint32_t Delay) {
+	tick += Delay;
+}
+
+uint32_t HAL_GetTick(void) {
+	return tick;
+}
+
+/* A single thread of execution, reported as a running kernel so that the mirroring stream waits
+ * for buffer space in osDelay() instead of dropping packets, see st7735_sim.c */
+osKernelState_t osKernelGetState(void) {
+	return osKernelRunning;
+}
+
+osThreadId_t osThreadGetId(void) {
+	return (osThreadId_t)&tick;
+}
+
+bool sim_panel_locked(void) {
+	return mutex_depth != 0;
+}
+
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout) {
+	(void)mutex_id;
+	(void)timeout;
+	mutex_depth++;
+	return osOK;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id) {
+	(void)mutex_id;
+	mutex_depth--;
+	return osOK;
+}
+
+/* The scheduler lock of display.c, nothing preempts on the host */
+int32_t osKernelLock(void) {
+	return 0;
+}
+
+int32_t osKernelUnlock(void) {
+	return 0;
+}
+
+/* The render task is never started, the simulation calls display_render() in its place */
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+	(void)func;
+	(void)argument;
+	(void)attr;
+	return NULL;
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags) {
+	(void)thread_id;
+	return flags;
+}
+
+uint32_t osThreadFlagsClear(uint32_t flags) {
+	return flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout) {
+	(void)options;
+	(void)timeout;
+	return flags;
+}
@@ -0,0 +1,83 @@
+/**
+ * Virtual TFT display panel header
+ *
+ * Host replacement of the HAL SPI and GPIO functions used by the ST7735 driver. Every byte the
+ * driver sends is decoded as the panel controller would: the address window (CASET/RASET), memory
+ * writes (RAMWR), memory access control (MADCTL), vertical scrolling (VSCRDEF/VSCRSADD), sleep,
+ * display on/off and inversion. The panel memory can then be saved or compared as a PPM image.
+ */
+
+#ifndef __SIM_PANEL_H__
+#define __SIM_PANEL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Visible panel size in its native portrait orientation */
+#define SIM_PANEL_W 128
+#define SIM_PANEL_H 160
+
+/**
+ * @brief SPI traffic seen by the panel.
+ * @param transactions Number of HAL SPI transmit calls (blocking or DMA)
+ * @param selects Number of chip select cycles
+ * @param bytes Number of bytes on the wire, commands and data
+ * @param commands Number of command bytes
+ * @param pixels Number of pixels written to the panel memory
+ * @param stray Number of bytes sent while the panel was not selected
+ */
+typedef struct {
+	uint32_t transactions;
+	uint32_t selects;
+	uint32_t bytes;
+	uint32_t commands;
+	uint32_t pixels;
+	uint32_t stray;
+} sim_stats_t;
+
+/**
+ * @brief Resets the panel to its power-on state: memory cleared, sleeping, display off.
+ */
+void sim_panel_reset(void);
+
+/**
+ * @brief Reads the traffic counters.
+ * @param stats Pointer to the structure receiving the counters.
+ */
+void sim_get_stats(sim_stats_t *stats);
+
+/**
+ * @brief Clears the traffic counters.
+ */
+void sim_reset_stats(void);
+
+/**
+ * @brief Reads a pixel as shown by the panel.
+ * @details Applies the vertical scrolling, the inversion and the display state.
+ * @param x The column of the panel, 0 to SIM_PANEL_W - 1.
+ * @param y The row of the panel, 0 to SIM_PANEL_H - 1.
+ * @return The RGB565 color shown.
+ */
+uint16_t sim_panel_pixel(int16_t x, int16_t y);
+
+/**
+ * @brief Tells whether the driver holds the screen mutex.
+ * @return True while the driver is drawing.
+ */
+bool sim_panel_locked(void);
+
+/**
+ * @brief Saves what the panel shows as a binary PPM image.
+ * @param path The file to write.
+ * @return True on success.
+ */
+bool sim_panel_save(const char *path);
+
+/**
+ * @brief Compares what the panel shows with a PPM image saved by sim_panel_save().
+ * @param path The reference image.
+ * @return Number of pixels which differ, -1 if the image can not be read or has another size.
+ */
+int32_t sim_panel_compare(const char *path);
+
+#endif /* __SIM_PANEL_H__ */
@@ -0,0 +1,468 @@
+/**
+ * Host simulator of the TFT display
+ *
+ * Runs the screen code of the firmware (common.c and display.c) and the ST7735 driver on the host
+ * against the virtual panel of sim_panel.c, with the sensors of sim_board.c, and draws the screens
+ * one after the other. For every screen it reports the SPI traffic and the estimated time on the
+ * wire, saves what the panel shows as a PPM image and optionally compares it with a reference
+ * image and a traffic budget, so rendering changes can be measured and checked without a board.
+ *
+ * Usage: st7735_sim [-o dir] [-r dir] [-b file] [-m dir] [-f spi_hz] [-t overhead_ns]
+ *   -o dir          Directory receiving the <screen>.ppm images, none are written by default
+ *   -r dir          Directory of reference images, the exit status is 1 if any screen differs
+ *   -b file         Traffic budget, lines of "<screen> <bytes> <transactions> <refresh_bytes>
+ *                   <refresh_transactions>", the exit status is 1 if any screen sends more in
+ *                   total or in any single refresh of the render task
+ *   -m dir          Mirror the screens, the stream of every screen goes to <screen>.mirror and
+ *                   its size and time on the 115200 baud link are reported
+ *   -f spi_hz       SPI clock, 21 MHz by default as configured for SPI2
+ *   -t overhead_ns  CPU time spent per HAL transmit call, added to the wire time
+ *
+ * The mirror files can be decoded one after the other with Tools/mirror_view.py, which must give
+ * the same images.
+ */
+
+#include "sim_panel.h"
+#include "sim_board.h"
+#include "common.h"
+#include "display.h"
+#include "ST7735.h"
+#include "ST7735_FONTS.h"
+#include "ST7735_MIRROR.h"
+#include "ST7735_SCROLL.h"
+#include "cmsis_os.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Default SPI2 clock: APB1 at 42 MHz divided by 2 */
+#define SIM_SPI_HZ 21000000UL
+
+/* Default CPU time of a HAL transmit call and of the chip select handling around it */
+#define SIM_OVERHEAD_NS 1500UL
+
+/* Baud rate and bits per byte of USART1, which carries the mirroring stream */
+#define SIM_UART_BAUD 115200UL
+#define SIM_UART_BITS 10
+
+/* File receiving the mirroring stream of the current screen, NULL when not mirroring */
+static FILE *mirror_file;
+
+/* Bytes of the mirroring stream of the current screen */
+static uint32_t mirror_bytes;
+
+/* Longest screen name in a budget file */
+#define SIM_NAME_LEN 16
+
+/**
+ * @brief Traffic budget of a screen.
+ * @param name Name of the screen
+ * @param bytes Most bytes the screen may send
+ * @param transactions Most HAL transmit calls the screen may make
+ * @param refresh_bytes Most bytes a single refresh of the screen may send
+ * @param refresh_transactions Most HAL transmit calls a single refresh of the screen may make
+ */
+typedef struct {
+	char name[SIM_NAME_LEN];
+	unsigned long bytes, transactions;
+	unsigned long refresh_bytes, refresh_transactions;
+} sim_budget_t;
+
+/* Budgets read from the budget file */
+static sim_budget_t budgets[32];
+static size_t budget_count;
+
+/* Largest refresh of the current screen, in bytes and in transactions */
+static uint32_t refresh_bytes, refresh_transactions;
+
+/* Readings of an ordinary measurement period, all levels good */
+static const sim_readings_t readings_ok = {45, 748, 23, 612, 14, 320};
+
+/* State of the pseudo-random readings */
+static uint32_t seed = 1;
+
+/**
+ * @brief Moves the mirroring stream from its buffer to the mirror file.
+ */
+static void sim_mirror_drain(void) {
+	uint8_t buf[4 * ST7735_MIRROR_PACKET_MAX];
+	uint16_t n;
+	while ((n = ST7735_mirror_read(buf, sizeof(buf))) > 0) {
+		if (mirror_file)
+			fwrite(buf, 1, n, mirror_file);
+		mirror_bytes += n;
+	}
+}
+
+/**
+ * @brief Runs the render task once and keeps the traffic of its refresh if it is the largest.
+ * @details What the render task sends in one go is what a screen update costs on the wire.
+ */
+static void sim_refresh(void) {
+	sim_stats_t before, after;
+	sim_get_stats(&before);
+	display_render();
+	sim_get_stats(&after);
+	if (after.bytes - before.bytes > refresh_bytes)
+		refresh_bytes = after.bytes - before.bytes;
+	if (after.transactions - before.transactions > refresh_transactions)
+		refresh_transactions = after.transactions - before.transactions;
+}
+
+/* Called by the tasks going to sleep: the mirroring stream while its buffer is full, common.c
+ * and display.c. The render task would run meanwhile, unless the sleeping task holds the screen */
+osStatus_t osDelay(uint32_t ticks) {
+	(void)ticks;
+	sim_mirror_drain();
+	if (!sim_panel_locked())
+		sim_refresh();
+	return osOK;
+}
+
+/**
+ * @brief Returns a pseudo-random value, the same sequence on every run.
+ * @param min, max Range of the value.
+ */
+static int32_t sim_random(int32_t min, int32_t max) {
+	seed = seed * 1103515245 + 12345;
+	return min + (int32_t)((seed >> 16) % (uint32_t)(max - min + 1));
+}
+
+/**
+ * @brief Runs one measurement period: a sensor read and the measurements screen output.
+ * @param readings The readings of the sensors.
+ */
+static void sim_period(const sim_readings_t *readings) {
+	sim_board_readings(readings);
+	sensor_working();
+	sensor_out();
+}
+
+/* Initialization screen: controller setup and the start messages */
+static void screen_boot(void) {
+	sensor_init();
+}
+
+/* Measurements screen drawn from a clean display */
+static void screen_sensors(void) {
+	sim_period(&readings_ok);
+}
+
+/* One measurement period on the measurements screen: a few digits, a chart sample and an icon */
+static void screen_update(void) {
+	sim_readings_t r = {46, 748, 24, 845, 15, 318};
+	sim_period(&r);
+}
+
+/* Measurements screen after a full sweep of the charts */
+static void screen_sweep(void) {
+	for (uint8_t i = 0; i < ST7735_TFTWIDTH_128; i++) {
+		sim_readings_t r = {sim_random(35, 55), sim_random(735, 760), sim_random(22, 25),
+				sim_random(500, 1100), sim_random(5, 40), sim_random(150, 600)};
+		sim_period(&r);
+	}
+}
+
+/* Display asleep after the inactivity timeout, the panel is blank */
+static void screen_sleep(void) {
+	display_sleep(true);
+}
+
+/* Display woken up by a button, the picture kept in the frame memory comes back */
+static void screen_wake(void) {
+	display_sleep(false);
+}
+
+/* CO2 out of its limit, the alert banner goes over the charts when the framebuffer is enabled */
+static void screen_alert(void) {
+	sim_readings_t r = readings_ok;
+	r.co2 = 1800;
+	sim_period(&r);
+}
+
+/* CO2 back to normal, only the banner area is sent again from the framebuffer */
+static void screen_dismiss(void) {
+	sim_period(&readings_ok);
+}
+
+/* Menu opened with the yellow button */
+static void screen_menu(void) {
+	buttonHandlers[YELLOW_BUTTON_Pin]();
+	menu_func();
+}
+
+/* Temperature limits chosen in the menu with the green button */
+static void screen_limits(void) {
+	buttonHandlers[GREEN_BUTTON_Pin]();
+	barrier_ctrl_func();
+	/* Back to the measurements screen */
+	buttonHandlers[RED_BUTTON_Pin]();
+}
+
+/* Proportional fonts */
+static void screen_fonts(void) {
+	ST7735_fill(ST7735_BLUE);
+	ST7735_text(2, 2, "Prop 8: Temperature 23 C", &font_prop8, ST7735_WHITE, ST7735_BLUE);
+	ST7735_text(2, 14, "Prop 16: 748 mmHg", &font_prop16, ST7735_YELLOW, ST7735_BLUE);
+	ST7735_text(2, 34, "612 ppm", &font_prop24, ST7735_GREEN, ST7735_BLUE);
+	ST7735_text(2, 62, "Transparent text", &font_prop16, ST7735_CYAN, ST7735_CYAN);
+	ST7735_fill_rect(2, 84, 124, 20, ST7735_BLACK);
+	ST7735_text(6, 86, "Opaque text", &font_prop16, ST7735_WHITE, ST7735_BLACK);
+}
+
+/* Drawing primitives */
+static void screen_shapes(void) {
+	ST7735_fill(ST7735_BLACK);
+	ST7735_print_config(2, 2, "Menu:", ST7735_WHITE, ST7735_BLACK, 1, 1);
+	ST7735_print_config(2, 14, "* Temperature limits", ST7735_WHITE, ST7735_BLACK, 1, 1);
+	ST7735_rect(0, 0, 128, 160, ST7735_WHITE);
+	ST7735_line(4, 40, 123, 150, ST7735_RED);
+	ST7735_line(4, 150, 123, 40, ST7735_BLUE);
+	ST7735_circle(64, 95, 30, ST7735_YELLOW);
+	ST7735_fill_circle(64, 95, 12, ST7735_GREEN);
+}
+
+/* Console scrolled in hardware */
+static void screen_console(void) {
+	st7735_console_t console;
+	char text[24];
+	ST7735_fill(ST7735_BLACK);
+	ST7735_console_init(&console, 16, 12, ST7735_GREEN, ST7735_BLACK);
+	for (uint8_t i = 0; i < 20; i++) {
+		/* Terminated as the log lines of the firmware, which must not leave empty rows */
+		snprintf(text, sizeof(text), "Log line %u\r\n", i);
+		ST7735_console_print(&console, text);
+	}
+}
+
+/* Strip chart of the strip screens, kept between them */
+static st7735_strip_t strip;
+
+/**
+ * @brief Draws a strip chart in a band between two fixed margins, in the given rotation.
+ * @details Rotations 1 and 3 scroll along opposite directions of the frame memory, the same
+ * samples must give the same picture in both.
+ * @param m The rotation, 1 or 3.
+ */
+static void sim_strip(int m) {
+	ST7735_set_rotation(m);
+	ST7735_fill(ST7735_BLACK);
+	ST7735_fill_rect(0, 0, 16, ST7735_TFTWIDTH_128, ST7735_BLUE);
+	ST7735_fill_rect(144, 0, 16, ST7735_TFTWIDTH_128, ST7735_BLUE);
+	ST7735_strip_init(&strip, 16, 128, 0, 100, ST7735_GREEN, ST7735_BLACK);
+	/* More samples than the band holds, so that it wraps */
+	for (uint16_t i = 0; i < 200; i++)
+		ST7735_strip_add(&strip, (i * 7) % 80 + (i % 5) * 4);
+}
+
+/* Strip chart scrolled in hardware in rotation 1 */
+static void screen_strip(void) {
+	sim_strip(1);
+}
+
+/* One more strip chart sample: one column of pixels and one scroll start command */
+static void screen_strip_add(void) {
+	ST7735_strip_add(&strip, 50);
+}
+
+/* Strip chart scrolled in hardware in rotation 3, the same picture as in rotation 1 */
+static void screen_strip_r3(void) {
+	sim_strip(3);
+}
+
+/**
+ * @brief Reads a traffic budget file.
+ * @details Lines starting with '#' are comments.
+ * @param path The budget file.
+ * @return False if the file can not be read.
+ */
+static bool sim_budget_load(const char *path) {
+	FILE *f = fopen(path, "r");
+	if (!f)
+		return false;
+	char line[128];
+	while (fgets(line, sizeof(line), f) && (budget_count < sizeof(budgets) / sizeof(budgets[0]))) {
+		sim_budget_t *b = &budgets[budget_count];
+		if ((line[0] != '#') &&
+				(sscanf(line, "%15s %lu %lu %lu %lu", b->name, &b->bytes, &b->transactions,
+						&b->refresh_bytes, &b->refresh_transactions) == 5))
+			budget_count++;
+	}
+	fclose(f);
+	return true;
+}
+
+/**
+ * @brief Looks up the budget of a screen.
+ * @param name Name of the screen.
+ * @return The budget, NULL if the screen has none.
+ */
+static const sim_budget_t *sim_budget_find(const char *name) {
+	for (size_t i = 0; i < budget_count; i++) {
+		if (!strcmp(budgets[i].name, name))
+			return &budgets[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Screen of the simulation.
+ * @param name Name of the screen, also the name of its image.
+ * @param draw Function drawing the screen.
+ */
+typedef struct {
+	const char *name;
+	void (*draw)(void);
+} sim_screen_t;
+
+static const sim_screen_t screens[] = {
+		{"boot", screen_boot},
+		{"sensors", screen_sensors},
+		{"update", screen_update},
+		{"sweep", screen_sweep},
+		{"sleep", screen_sleep},
+		{"wake", screen_wake},
+		{"alert", screen_alert},
+		{"dismiss", screen_dismiss},
+		{"menu", screen_menu},
+		{"limits", screen_limits},
+		{"fonts", screen_fonts},
+		{"shapes", screen_shapes},
+		{"console", screen_console},
+		{"strip", screen_strip},
+		{"strip_add", screen_strip_add},
+		{"strip_r3", screen_strip_r3},
+};
+
+int main(int argc, char **argv) {
+	const char *out_dir = NULL, *ref_dir = NULL, *budget_path = NULL, *mirror_dir = NULL;
+	unsigned long spi_hz = SIM_SPI_HZ, overhead_ns = SIM_OVERHEAD_NS;
+	int opt;
+	while ((opt = getopt(argc, argv, "o:r:b:m:f:t:")) != -1) {
+		switch (opt) {
+			case 'o':
+				out_dir = optarg;
+				break;
+			case 'r':
+				ref_dir = optarg;
+				break;
+			case 'b':
+				budget_path = optarg;
+				break;
+			case 'm':
+				mirror_dir = optarg;
+				break;
+			case 'f':
+				spi_hz = strtoul(optarg, NULL, 0);
+				break;
+			case 't':
+				overhead_ns = strtoul(optarg, NULL, 0);
+				break;
+			default:
+				fprintf(stderr,
+						"usage: %s [-o dir] [-r dir] [-b file] [-m dir] [-f spi_hz] "
+						"[-t overhead_ns]\n", argv[0]);
+				return 2;
+		}
+	}
+	if (!spi_hz) {
+		fprintf(stderr, "SPI clock must not be zero\n");
+		return 2;
+	}
+	if (budget_path && !sim_budget_load(budget_path)) {
+		fprintf(stderr, "can not read %s\n", budget_path);
+		return 2;
+	}
+
+	int status = 0;
+	printf("%-8s %8s %6s %8s %6s %5s %7s %7s %9s %9s %8s %8s %s\n", "screen", "bytes", "txns",
+			"rf_bytes", "rf_txn", "cs", "cmds", "pixels", "wire_us", "est_us", "mirror",
+			"uart_ms", "image");
+	if (mirror_dir)
+		ST7735_mirror(true);
+	for (size_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+		sim_stats_t s;
+		char path[512];
+		const char *result = "-";
+
+		if (mirror_dir) {
+			snprintf(path, sizeof(path), "%s/%s.mirror", mirror_dir, screens[i].name);
+			mirror_file = fopen(path, "wb");
+			if (!mirror_file) {
+				fprintf(stderr, "can not write %s\n", path);
+				status = 1;
+			}
+		}
+		mirror_bytes = 0;
+
+		sim_reset_stats();
+		refresh_bytes = 0;
+		refresh_transactions = 0;
+		screens[i].draw();
+		/* The render task draws what is still queued */
+		sim_refresh();
+		sim_get_stats(&s);
+
+		sim_mirror_drain();
+		if (mirror_file) {
+			fclose(mirror_file);
+			mirror_file = NULL;
+		}
+
+		if (out_dir) {
+			snprintf(path, sizeof(path), "%s/%s.ppm", out_dir, screens[i].name);
+			if (!sim_panel_save(path)) {
+				fprintf(stderr, "can not write %s\n", path);
+				status = 1;
+			}
+		}
+		if (ref_dir) {
+			snprintf(path, sizeof(path), "%s/%s.ppm", ref_dir, screens[i].name);
+			int32_t diff = sim_panel_compare(path);
+			result = diff == 0 ? "same" : "DIFFERS";
+			if (diff < 0)
+				fprintf(stderr, "can not read %s\n", path);
+			else if (diff > 0)
+				fprintf(stderr, "%s: %ld pixels differ from %s\n", screens[i].name, (long)diff,
+						path);
+			if (diff != 0)
+				status = 1;
+		}
+
+		double wire_us = s.bytes * 8.0 * 1e6 / spi_hz;
+		double est_us = wire_us + s.transactions * overhead_ns / 1000.0;
+		double uart_ms = mirror_bytes * SIM_UART_BITS * 1e3 / SIM_UART_BAUD;
+		printf("%-8s %8lu %6lu %8lu %6lu %5lu %7lu %7lu %9.0f %9.0f %8lu %8.0f %s\n",
+				screens[i].name, (unsigned long)s.bytes, (unsigned long)s.transactions,
+				(unsigned long)refresh_bytes, (unsigned long)refresh_transactions,
+				(unsigned long)s.selects, (unsigned long)s.commands, (unsigned long)s.pixels,
+				wire_us, est_us, (unsigned long)mirror_bytes, uart_ms, result);
+		if (budget_path) {
+			const sim_budget_t *b = sim_budget_find(screens[i].name);
+			if (!b) {
+				fprintf(stderr, "%s: no budget in %s\n", screens[i].name, budget_path);
+				status = 1;
+			} else if ((s.bytes > b->bytes) || (s.transactions > b->transactions)) {
+				fprintf(stderr, "%s: %lu bytes in %lu transactions, budget %lu in %lu\n",
+						screens[i].name, (unsigned long)s.bytes, (unsigned long)s.transactions,
+						b->bytes, b->transactions);
+				status = 1;
+			}
+			if (b && ((refresh_bytes > b->refresh_bytes) ||
+					(refresh_transactions > b->refresh_transactions))) {
+				fprintf(stderr, "%s: refresh of %lu bytes in %lu transactions, budget %lu in %lu\n",
+						screens[i].name, (unsigned long)refresh_bytes,
+						(unsigned long)refresh_transactions, b->refresh_bytes,
+						b->refresh_transactions);
+				status = 1;
+			}
+		}
+		if (s.stray) {
+			fprintf(stderr, "%s: %lu bytes sent without chip select\n", screens[i].name,
+					(unsigned long)s.stray);
+			status = 1;
+		}
+	}
+	return status;
+}